@@ -17,6 +17,24 @@ enum ResolutionOption
   HIGH = 600,
 };
 
+enum class UpscaleFilter
+{
+  NEAREST,
+  SHARP_BILINEAR,
+};
+
+enum class WallRenderer
+{
+  RAYCAST,
+  SEGMENTS,
+};
+
+enum class CrowdSteering
+{
+  TILE_RESERVATION,
+  ORCA,
+};
+
 struct Configuration
 {
   sf::Vector2f player_initial_position = sf::Vector2f{ 100.f, 100.f };
@@ -29,8 +47,20 @@ struct Configuration
   unsigned render_distance = 1000u;
   float attenuation_distance = 16.f;
   bool enable_fish_eye = false;
+  WallRenderer wall_renderer = WallRenderer::RAYCAST;
+  bool enable_tile_lighting = true;
+  bool enable_mipmaps = true;
+  unsigned ai_reduced_thinks_per_step = 8u;
+  unsigned ai_dormant_thinks_per_step = 2u;
+  CrowdSteering crowd_steering = CrowdSteering::TILE_RESERVATION;
   float tile_size = 64.f;
   float player_eye_height = tile_size * 2.f / 3.f;
+  float render_scale = 1.f;
+  UpscaleFilter upscale_filter = UpscaleFilter::NEAREST;
+  bool dynamic_resolution = true;
+  float target_frame_ms = 14.f;
+  bool vertical_sync = true;
+  unsigned frame_rate_limit = 0u;
 };
 
 #endif //NULLP0INT_CONFIGURATION_H
\ No newline at end of file
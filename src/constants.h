@@ -16,12 +16,31 @@ constexpr double   BIGGER_EPSILON                     = 1e-12;
 constexpr double   EPSILON_DIST                       = 1e-9;
 constexpr float    SAFE_REPEAT_BEFORE_NORMALIZATION   = 1024.f;
 constexpr unsigned MAX_ITEMS_TO_RENDER                = 8192;
+constexpr float    MIN_RENDER_SCALE                   = 0.5f;
+constexpr float    DYNAMIC_RES_SMOOTHING              = 0.1f;
+constexpr float    DYNAMIC_RES_UPGRADE_HEADROOM       = 0.7f;
+constexpr int      DYNAMIC_RES_DOWNGRADE_FRAMES       = 15;
+constexpr int      DYNAMIC_RES_UPGRADE_FRAMES         = 90;
+constexpr float    SIMULATION_HZ                      = 120.f;
+constexpr float    FIXED_TIMESTEP_SECONDS             = 1.f / SIMULATION_HZ;
+constexpr int      MAX_SIMULATION_STEPS_PER_FRAME     = 8;
+constexpr float    NAV_REPLAN_INTERVAL_SECONDS        = 1.5f;
+constexpr int      NAV_REPLAN_GOAL_DRIFT_TILES        = 2;
+constexpr float    NAV_WAYPOINT_REACHED_TILES         = 0.25f;
+constexpr float    AI_LOD_NEAR_TILES                  = 12.f;
+constexpr float    AI_LOD_REDUCED_INTERVAL_SECONDS    = 0.1f;
+constexpr float    AI_LOD_DORMANT_INTERVAL_SECONDS    = 0.25f;
+constexpr int      ENEMY_DECIDE_PARALLEL_MIN_ENEMIES  = 32;
+constexpr float    CROWD_NEIGHBOUR_DIST_TILES         = 3.f;
+constexpr float    CROWD_TIME_HORIZON_SECONDS         = 1.f;
+constexpr int      CROWD_MAX_NEIGHBOURS               = 10;
 constexpr char     FLOOR_MARKER                       = ' ';
 constexpr char     SPAWN_MARKER                       = '*';
 constexpr char     END_MARKER                         = '>';
 constexpr char     MELEE_ENEMY_SPAWN_MARKER           = '&';
 constexpr char     RANGE_ENEMY_SPAWN_MARKER           = '9';
 constexpr char     SUPPORT_ENEMY_SPAWN_MARKER         = '@';
+constexpr char     MAP_DIRECTIVE_MARKER               = '~';
 constexpr float    MOUSE_DEG_PER_PIXEL                = 0.12f;
 constexpr auto     UI_FONT_PATH                       = "resources/fonts/tektur/Tektur-Black.ttf";
 
@@ -36,6 +55,18 @@ constexpr float    PARRY_ANIM_FRAME_TIME_SECONDS      = 0.09f;
 constexpr float    PARRY_CROSSHAIR_FLASH_SECONDS      = 0.15f;
 
 constexpr float    HITMARKER_DURATION_SECONDS         = 0.12f;
+constexpr int      HUD_VIGNETTE_INTENSITY_STEPS       = 32;
+
+constexpr unsigned char LIGHTMAP_AMBIENT              = 200;
+constexpr unsigned char LIGHTMAP_OCCLUSION_PER_WALL   = 10;
+constexpr float    LIGHTMAP_EMITTER_INTENSITY         = 110.f;
+constexpr float    LIGHTMAP_EMITTER_RADIUS_TILES      = 4.f;
+constexpr unsigned MAX_DYNAMIC_LIGHTS                 = 16;
+constexpr float    MUZZLE_FLASH_SECONDS               = 0.08f;
+constexpr float    MUZZLE_FLASH_INTENSITY             = 120.f;
+constexpr float    MUZZLE_FLASH_RADIUS_TILES          = 5.f;
+constexpr float    PROJECTILE_LIGHT_INTENSITY         = 70.f;
+constexpr float    PROJECTILE_LIGHT_RADIUS_TILES      = 2.5f;
 
 
 #endif //NULLP0INT_CONSTANTS_H
\ No newline at end of file
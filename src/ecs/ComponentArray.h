@@ -32,6 +32,14 @@ namespace ecs
     {
       return data.contains(e);
     }
+    void assign(const ComponentArray& other)
+    {
+      data = other.data;
+    }
+    void clear()
+    {
+      data.clear();
+    }
   };
 }
 
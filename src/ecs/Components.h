@@ -7,7 +7,10 @@
 #ifndef NULLP0INT_COMPONENTS_H
 #define NULLP0INT_COMPONENTS_H
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <iterator>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -50,6 +53,14 @@ namespace ecs
     float angle = 0.f;
   };
 
+  struct InterpolationComponent
+  {
+    sf::Vector2f previousPosition{};
+    float previousAngle = 0.f;
+    sf::Vector2f currentPosition{};
+    float currentAngle = 0.f;
+  };
+
   struct RadiusComponent
   {
     float radius = 0.f;
@@ -128,6 +139,32 @@ namespace ecs
   };
   struct EnemyTag{};
 
+  struct NavPathComponent
+  {
+    std::vector<sf::Vector2f> waypoints;
+    std::size_t next = 0;
+    sf::Vector2i goalTile{-1, -1};
+    float replanTimerSeconds = 0.f;
+    std::uint32_t lastFollowTick = 0;
+    bool unreachable = false;
+  };
+
+  enum class AiLodTier
+  {
+    FULL,
+    REDUCED,
+    DORMANT,
+  };
+
+  struct AiLodComponent
+  {
+    AiLodTier tier = AiLodTier::FULL;
+    float secondsSinceThink = 0.f;
+    std::uint32_t lastThinkTick = 0;
+    bool steeringToTile = false;
+    sf::Vector2i steerTile{};
+  };
+
 
   struct TilemapTag{};
 
@@ -151,6 +188,16 @@ namespace ecs
     }
   };
 
+  struct WallSegment
+  {
+    sf::Vector2f start{};
+    sf::Vector2f end{};
+    sf::Vector2i normal{};
+    float textureOffset = 0.f;
+
+    [[nodiscard]] bool isVertical() const { return normal.x != 0; }
+  };
+
   struct TilemapComponent
   {
     unsigned width = 0;
@@ -158,9 +205,72 @@ namespace ecs
     float tileSize = 64.f;
     std::vector<std::string> tiles;
     std::string floorTextureId;
+    std::string ceilingTextureId;
+
+    std::vector<std::string> floorTexturePalette;
+    std::vector<std::uint8_t> floorTextureIndices;
 
     std::unordered_map<char, TileAppearance> tileAppearanceMap;
 
+    std::vector<std::uint8_t> bakedLight;
+    std::vector<WallSegment> wallSegments;
+    std::uint32_t revision = 0;
+
+    void markTilesChanged()
+    {
+      static std::uint32_t nextRevision = 0;
+      revision = ++nextRevision;
+    }
+
+    [[nodiscard]] std::uint8_t bakedLightAt(const int tx, const int ty) const
+    {
+      if (bakedLight.empty()) return LIGHTMAP_AMBIENT;
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(width) || ty >= static_cast<int>(height)) return LIGHTMAP_AMBIENT;
+      return bakedLight[static_cast<std::size_t>(ty) * width + static_cast<std::size_t>(tx)];
+    }
+
+    [[nodiscard]] std::uint8_t floorTextureIndexAt(const int tx, const int ty) const
+    {
+      if (floorTextureIndices.empty()) return 0;
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(width) || ty >= static_cast<int>(height)) return 0;
+      return floorTextureIndices[static_cast<std::size_t>(ty) * width + static_cast<std::size_t>(tx)];
+    }
+
+    [[nodiscard]] const std::string& floorTextureIdAt(const int tx, const int ty) const
+    {
+      const std::uint8_t idx = floorTextureIndexAt(tx, ty);
+      if (idx == 0 || idx > floorTexturePalette.size()) return floorTextureId;
+      return floorTexturePalette[idx - 1];
+    }
+
+    void setFloorTexture(const int tx, const int ty, const std::string& texId)
+    {
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(width) || ty >= static_cast<int>(height)) return;
+
+      std::uint8_t idx = 0;
+      if (texId != floorTextureId)
+      {
+        const auto it = std::ranges::find(floorTexturePalette, texId);
+        if (it != floorTexturePalette.end())
+        {
+          idx = static_cast<std::uint8_t>(std::distance(floorTexturePalette.begin(), it) + 1);
+        }
+        else
+        {
+          if (floorTexturePalette.size() >= 255) return;
+          floorTexturePalette.push_back(texId);
+          idx = static_cast<std::uint8_t>(floorTexturePalette.size());
+        }
+      }
+
+      if (floorTextureIndices.empty())
+      {
+        if (idx == 0) return;
+        floorTextureIndices.assign(static_cast<std::size_t>(width) * height, 0);
+      }
+      floorTextureIndices[static_cast<std::size_t>(ty) * width + static_cast<std::size_t>(tx)] = idx;
+    }
+
     [[nodiscard]] bool isWall(const int tx, const int ty) const
     {
       if (tx < 0 || ty < 0 || tx >= static_cast<int>(width) || ty >= static_cast<int>(height))
@@ -209,6 +319,8 @@ namespace ecs
     float distance = 0.f;
     int tileX = -1;
     int tileY = -1;
+    int faceTileX = -1;
+    int faceTileY = -1;
     bool vertical = false;
     float rayAngle = 0.f;
   };
@@ -216,6 +328,50 @@ namespace ecs
   struct RayCastResultComponent
   {
     std::vector<RayHit> hits;
+
+    std::vector<std::uint64_t> visibleTiles;
+    unsigned visibleWidth = 0;
+    unsigned visibleHeight = 0;
+
+    void resetVisibleTiles(const unsigned w, const unsigned h)
+    {
+      visibleWidth = w;
+      visibleHeight = h;
+      visibleTiles.assign((static_cast<std::size_t>(w) * h + 63u) / 64u, 0u);
+    }
+
+    void markVisibleTile(const int tx, const int ty)
+    {
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(visibleWidth) || ty >= static_cast<int>(visibleHeight)) return;
+      const std::size_t idx = static_cast<std::size_t>(ty) * visibleWidth + static_cast<std::size_t>(tx);
+      visibleTiles[idx >> 6u] |= std::uint64_t{1} << (idx & 63u);
+    }
+
+    [[nodiscard]] bool isTileVisible(const int tx, const int ty) const
+    {
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(visibleWidth) || ty >= static_cast<int>(visibleHeight)) return false;
+      const std::size_t idx = static_cast<std::size_t>(ty) * visibleWidth + static_cast<std::size_t>(tx);
+      return (visibleTiles[idx >> 6u] >> (idx & 63u)) & 1u;
+    }
+
+    [[nodiscard]] bool isAreaVisible(const sf::Vector2f worldPos, const float halfExtent, const float tileSize) const
+    {
+      if (visibleTiles.empty()) return true;
+
+      const int x0 = static_cast<int>(std::floor((worldPos.x - halfExtent) / tileSize));
+      const int x1 = static_cast<int>(std::floor((worldPos.x + halfExtent) / tileSize));
+      const int y0 = static_cast<int>(std::floor((worldPos.y - halfExtent) / tileSize));
+      const int y1 = static_cast<int>(std::floor((worldPos.y + halfExtent) / tileSize));
+
+      for (int ty = y0; ty <= y1; ++ty)
+      {
+        for (int tx = x0; tx <= x1; ++tx)
+        {
+          if (isTileVisible(tx, ty)) return true;
+        }
+      }
+      return false;
+    }
   };
 
   struct SpriteComponent
@@ -276,6 +432,14 @@ namespace ecs
     float remainingSeconds = 0.f;
   };
 
+  struct PointLightComponent
+  {
+    float radiusTiles = 3.f;
+    float intensity = 100.f;
+    float remainingSeconds = -1.f;
+    float durationSeconds = 0.f;
+  };
+
   struct PlayerWeaponInputState
   {
     bool prevFire = false;
@@ -76,3 +76,12 @@ void ecs::Registry::destroyEntity(const Entity e)
   ++m_generations[idx];
   m_freeIndices.push_back(idx);
 }
+
+void ecs::Registry::mirrorEntities(const Registry& source)
+{
+  m_nextIndex = source.m_nextIndex;
+  m_generations = source.m_generations;
+  m_alive = source.m_alive;
+  m_freeIndices = source.m_freeIndices;
+  m_entities = source.m_entities;
+}
@@ -29,6 +29,8 @@ namespace ecs
 
     void destroyEntity(Entity e);
 
+    void mirrorEntities(const Registry& source);
+
     template<typename T>
     void addComponent(Entity e, const T& comp)
     {
@@ -83,6 +85,35 @@ namespace ecs
       return arr->has(e);
     }
 
+    template<typename T>
+    void copyComponents(const Registry& source)
+    {
+      const auto ti = std::type_index(typeid(T));
+      const auto src = source.m_components.find(ti);
+      const auto it = m_components.find(ti);
+
+      if (src == source.m_components.end())
+      {
+        if (it != m_components.end()) std::static_pointer_cast<ComponentArray<T>>(it->second)->clear();
+        return;
+      }
+
+      const auto srcArr = std::static_pointer_cast<ComponentArray<T>>(src->second);
+      if (it == m_components.end())
+      {
+        auto arr = std::make_shared<ComponentArray<T>>();
+        arr->assign(*srcArr);
+        m_components[ti] = arr;
+        m_componentRemovers[ti] = [arr](Entity ent)
+        {
+          if (arr) arr->remove(ent);
+        };
+        return;
+      }
+
+      std::static_pointer_cast<ComponentArray<T>>(it->second)->assign(*srcArr);
+    }
+
   private:
     EntityIndex m_nextIndex{0};
 
@@ -4,8 +4,12 @@
 
 #include "MapLoaderSystem.h"
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <queue>
+#include <sstream>
 #include <vector>
 
 #include "../../Components.h"
@@ -24,10 +28,16 @@ ecs::Entity ecs::MapLoaderSystem::load(Registry &registry, const Configuration &
 
   std::string line;
   std::vector<std::string> strMap;
+  std::vector<std::string> directives;
   while (std::getline(file, line))
   {
     if (!line.empty() && line.back() == '\r') line.pop_back();
     if (line.empty()) continue;
+    if (line.front() == MAP_DIRECTIVE_MARKER)
+    {
+      directives.push_back(line.substr(1));
+      continue;
+    }
     strMap.push_back(line);
   }
 
@@ -40,12 +50,151 @@ ecs::Entity ecs::MapLoaderSystem::load(Registry &registry, const Configuration &
   const Entity    mapEntity = registry.createEntity();
   const auto      width     = static_cast<unsigned>(strMap[0].length());
   const auto      height    = static_cast<unsigned>(strMap.size());
-  registry.addComponent<TilemapComponent>(mapEntity, TilemapComponent{width, height, config.tile_size, strMap});
+  TilemapComponent tilemap{width, height, config.tile_size, strMap};
+  for (const auto& directive : directives) applyDirective(tilemap, directive);
+  tilemap.markTilesChanged();
+  bakeLightmap(tilemap);
+  extractWallSegments(tilemap);
+  registry.addComponent<TilemapComponent>(mapEntity, tilemap);
   registry.addComponent<TilemapTag>(mapEntity, TilemapTag{});
 
   return mapEntity;
 }
 
+void ecs::MapLoaderSystem::bakeLightmap(TilemapComponent &map)
+{
+  const std::size_t count = static_cast<std::size_t>(map.width) * map.height;
+  std::vector<float> light(count, 0.f);
+
+  auto isWallAt = [&](const int tx, const int ty)
+  {
+    if (!insideMapIs(&map, tx, ty)) return true;
+    if (static_cast<std::size_t>(tx) >= map.tiles[static_cast<std::size_t>(ty)].size()) return true;
+    return map.isWall(tx, ty);
+  };
+
+  for (int ty = 0; ty < static_cast<int>(map.height); ++ty)
+  {
+    for (int tx = 0; tx < static_cast<int>(map.width); ++tx)
+    {
+      if (isWallAt(tx, ty)) continue;
+
+      int walls = 0;
+      for (int oy = -1; oy <= 1; ++oy)
+      {
+        for (int ox = -1; ox <= 1; ++ox)
+        {
+          if ((ox != 0 || oy != 0) && isWallAt(tx + ox, ty + oy)) ++walls;
+        }
+      }
+
+      light[static_cast<std::size_t>(ty) * map.width + static_cast<std::size_t>(tx)] =
+        static_cast<float>(LIGHTMAP_AMBIENT) - static_cast<float>(walls * LIGHTMAP_OCCLUSION_PER_WALL);
+    }
+  }
+
+  const int reach = static_cast<int>(std::ceil(LIGHTMAP_EMITTER_RADIUS_TILES));
+  std::vector<int> steps(count, -1);
+  std::vector<std::size_t> touched;
+  std::queue<sf::Vector2i> frontier;
+
+  for (int ey = 0; ey < static_cast<int>(map.height); ++ey)
+  {
+    for (int ex = 0; ex < static_cast<int>(map.width); ++ex)
+    {
+      if (static_cast<std::size_t>(ex) >= map.tiles[static_cast<std::size_t>(ey)].size()) continue;
+      if (map.tiles[static_cast<std::size_t>(ey)][static_cast<std::size_t>(ex)] != END_MARKER) continue;
+
+      for (const std::size_t idx : touched) steps[idx] = -1;
+      touched.clear();
+
+      constexpr int dirs[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+      for (const auto& d : dirs)
+      {
+        const int nx = ex + d[0];
+        const int ny = ey + d[1];
+        if (isWallAt(nx, ny)) continue;
+
+        const std::size_t idx = static_cast<std::size_t>(ny) * map.width + static_cast<std::size_t>(nx);
+        if (steps[idx] >= 0) continue;
+        steps[idx] = 0;
+        touched.push_back(idx);
+        frontier.push({nx, ny});
+      }
+
+      while (!frontier.empty())
+      {
+        const sf::Vector2i cur = frontier.front();
+        frontier.pop();
+
+        const std::size_t idx = static_cast<std::size_t>(cur.y) * map.width + static_cast<std::size_t>(cur.x);
+        const float dx = static_cast<float>(cur.x - ex);
+        const float dy = static_cast<float>(cur.y - ey);
+        const float falloff = 1.f - std::sqrt(dx * dx + dy * dy) / (LIGHTMAP_EMITTER_RADIUS_TILES + 1.f);
+        if (falloff > 0.f) light[idx] += LIGHTMAP_EMITTER_INTENSITY * falloff;
+
+        if (steps[idx] >= reach) continue;
+        for (const auto& d : dirs)
+        {
+          const int nx = cur.x + d[0];
+          const int ny = cur.y + d[1];
+          if (isWallAt(nx, ny)) continue;
+
+          const std::size_t nidx = static_cast<std::size_t>(ny) * map.width + static_cast<std::size_t>(nx);
+          if (steps[nidx] >= 0) continue;
+          steps[nidx] = steps[idx] + 1;
+          touched.push_back(nidx);
+          frontier.push({nx, ny});
+        }
+      }
+    }
+  }
+
+  map.bakedLight.resize(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    map.bakedLight[i] = static_cast<std::uint8_t>(std::clamp(light[i], 0.f, 255.f));
+  }
+}
+
+void ecs::MapLoaderSystem::applyDirective(TilemapComponent &map, const std::string &directive)
+{
+  std::istringstream in(directive);
+  std::string kind;
+  in >> kind;
+
+  if (kind == "ceiling")
+  {
+    in >> map.ceilingTextureId;
+    return;
+  }
+
+  if (kind == "floor")
+  {
+    int x = 0;
+    int y = 0;
+    int w = 0;
+    int h = 0;
+    std::string texId;
+    if (!(in >> x >> y >> w >> h >> texId))
+    {
+      std::cerr << "Malformed floor directive: " << directive << std::endl;
+      return;
+    }
+
+    for (int ty = y; ty < y + h; ++ty)
+    {
+      for (int tx = x; tx < x + w; ++tx)
+      {
+        map.setFloorTexture(tx, ty, texId);
+      }
+    }
+    return;
+  }
+
+  std::cerr << "Unknown map directive: " << directive << std::endl;
+}
+
 sf::Vector2f ecs::getMapPosition(const sf::Vector2f position)
 {
   return static_cast<sf::Vector2f>(static_cast<sf::Vector2i>(position));
@@ -56,3 +205,57 @@ bool ecs::insideMapIs(const TilemapComponent *map, const int x, const int y)
   if (!map) return false;
   return x >= 0 && y >= 0 && x < static_cast<int>(map->width) && y < static_cast<int>(map->height);
 }
+
+void ecs::MapLoaderSystem::extractWallSegments(TilemapComponent &map)
+{
+  map.wallSegments.clear();
+
+  const int w = static_cast<int>(map.width);
+  const int h = static_cast<int>(map.height);
+
+  auto faceNormal = [&](const bool nearWall, const bool farWall) -> int
+  {
+    if (nearWall == farWall) return 0;
+    return nearWall ? 1 : -1;
+  };
+
+  for (int y = 0; y <= h; ++y)
+  {
+    int runStart = 0;
+    int runNormal = 0;
+    for (int x = 0; x <= w; ++x)
+    {
+      const int normal = (x < w) ? faceNormal(map.isWall(x, y - 1), map.isWall(x, y)) : 0;
+      if (normal == runNormal) continue;
+
+      if (runNormal != 0)
+      {
+        const auto fy = static_cast<float>(y);
+        map.wallSegments.push_back(WallSegment{
+          {static_cast<float>(runStart), fy}, {static_cast<float>(x), fy}, {0, runNormal}, static_cast<float>(runStart)});
+      }
+      runStart = x;
+      runNormal = normal;
+    }
+  }
+
+  for (int x = 0; x <= w; ++x)
+  {
+    int runStart = 0;
+    int runNormal = 0;
+    for (int y = 0; y <= h; ++y)
+    {
+      const int normal = (y < h) ? faceNormal(map.isWall(x - 1, y), map.isWall(x, y)) : 0;
+      if (normal == runNormal) continue;
+
+      if (runNormal != 0)
+      {
+        const auto fx = static_cast<float>(x);
+        map.wallSegments.push_back(WallSegment{
+          {fx, static_cast<float>(runStart)}, {fx, static_cast<float>(y)}, {runNormal, 0}, static_cast<float>(runStart)});
+      }
+      runStart = y;
+      runNormal = normal;
+    }
+  }
+}
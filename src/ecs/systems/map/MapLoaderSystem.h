@@ -18,6 +18,9 @@ namespace ecs
   {
   public:
     static Entity load(Registry& registry, const Configuration &config, const std::string& filename);
+    static void bakeLightmap(TilemapComponent& map);
+    static void extractWallSegments(TilemapComponent& map);
+    static void applyDirective(TilemapComponent& map, const std::string& directive);
   };
 
   sf::Vector2f getMapPosition(sf::Vector2f position);
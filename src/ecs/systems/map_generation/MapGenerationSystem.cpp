@@ -10,6 +10,8 @@
 #include <random>
 #include <vector>
 
+#include "../../../constants.h"
+
 bool Point::operator==(const Point &p) const
 {
   return x == p.x && y == p.y;
@@ -240,6 +242,12 @@ std::string MapGenerationSystem::print()
     file << "\n";
   }
 
+  for (const Room &room : m_rooms)
+  {
+    if (room.preset != exitPreset) continue;
+    file << MAP_DIRECTIVE_MARKER << "floor " << room.x << ' ' << room.y << ' ' << room.w << ' ' << room.h << " exit_floor\n";
+  }
+
   return filename;
 }
 
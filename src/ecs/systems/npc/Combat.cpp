@@ -7,6 +7,7 @@
 #include <algorithm>
 
 #include "../collision/CollisionSystem.h"
+#include "../physics/InterpolationSystem.h"
 
 #include "Movement.h"
 #include "PathfindingAnimation.h"
@@ -135,6 +136,8 @@ namespace ecs::npc
     pc.ignoreOwnerSeconds = 0.06f;
 
     registry.addComponent<ProjectileComponent>(proj, pc);
+    registry.addComponent<PointLightComponent>(proj, PointLightComponent{PROJECTILE_LIGHT_RADIUS_TILES, PROJECTILE_LIGHT_INTENSITY});
+    InterpolationSystem::snap(registry, proj);
     return proj;
   }
 
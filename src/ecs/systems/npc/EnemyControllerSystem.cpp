@@ -6,7 +6,8 @@
 
 #include <algorithm>
 #include <cmath>
-#include <unordered_set>
+#include <cstdint>
+#include <thread>
 #include <vector>
 
 #include <SFML/System/Vector2.hpp>
@@ -15,25 +16,33 @@
 #include "../../Entity.h"
 
 #include "../collision/CollisionSystem.h"
+#include "../../../math/mathUtils.h"
 
 #include "Combat.h"
 #include "Movement.h"
 #include "PathfindingAnimation.h"
+#include "PathfindingCrowd.h"
 #include "PathfindingDistanceField.h"
+#include "PathfindingInfluence.h"
+#include "PathfindingNavMesh.h"
+#include "PathfindingOccupancy.h"
 #include "PathfindingPerception.h"
 #include "PathfindingReservation.h"
 #include "PathfindingTypes.h"
+#include "PathfindingVisibility.h"
+#include "WorkerPool.h"
 
 namespace
 {
-  [[nodiscard]] std::unordered_set<int> buildInitiallyOccupied(
+  void markInitiallyOccupied(
     ecs::Registry& registry,
     const ecs::npc::Grid& g,
-    const ecs::TilemapComponent& tilemap
+    const ecs::TilemapComponent& tilemap,
+    ecs::npc::OccupancyGrid& occupancy,
+    ecs::npc::InfluenceMap& influence
   )
   {
-    std::unordered_set<int> occupied;
-    occupied.reserve(registry.entities().size());
+    occupancy.reset(g);
 
     for (const auto& e : registry.entities())
     {
@@ -45,14 +54,73 @@ namespace
       const sf::Vector2i t = tilemap.worldToTile(pos->position);
       if (!g.inBounds(t.x, t.y)) continue;
 
-      occupied.insert(g.idx(t.x, t.y));
+      occupancy.markOccupied(g.idx(t.x, t.y));
+      influence.addEnemy(t);
     }
+  }
+
+  [[nodiscard]] int maxVisionRangeTiles(ecs::Registry& registry)
+  {
+    float range = 0.f;
+    for (const auto& e : registry.entities())
+    {
+      if (!registry.hasComponent<ecs::EnemyTag>(e)) continue;
+
+      const auto* enemy = registry.getComponent<ecs::EnemyComponent>(e);
+      if (enemy && std::isfinite(enemy->visionRangeTiles)) range = std::max(range, enemy->visionRangeTiles);
+    }
+    return static_cast<int>(std::ceil(range));
+  }
 
-    return occupied;
+  [[nodiscard]] ecs::AiLodTier classifyLod(const ecs::EnemyComponent& enemy, const float distTiles, const bool visibleTile)
+  {
+    if (enemy.rangedDodgeActive || enemy.state == ecs::EnemyState::ATTACKING) return ecs::AiLodTier::FULL;
+
+    if (!enemy.hasSeenPlayer)
+    {
+      return (visibleTile && distTiles <= enemy.visionRangeTiles) ? ecs::AiLodTier::FULL : ecs::AiLodTier::DORMANT;
+    }
+
+    return (visibleTile || distTiles <= AI_LOD_NEAR_TILES) ? ecs::AiLodTier::FULL : ecs::AiLodTier::REDUCED;
+  }
+
+  [[nodiscard]] unsigned decideWorkerCount()
+  {
+    constexpr unsigned kReservedThreads = 2;
+    const unsigned hardware = std::thread::hardware_concurrency();
+    return hardware > kReservedThreads ? hardware - kReservedThreads : 0;
   }
 }
 
-void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemapEntity, const float dt)
+ecs::EnemyControllerSystem::EnemyControllerSystem()
+  : m_workers(decideWorkerCount())
+{
+}
+
+void ecs::EnemyControllerSystem::reset()
+{
+  m_distCache = {};
+  m_visibility = {};
+  m_navMesh = {};
+  m_navTick = 0;
+  m_initiallyOccupied = {};
+  m_influence = {};
+
+  m_crowd = {};
+  m_crowdAgents.clear();
+  m_thoughtThisStep.clear();
+  m_solved.clear();
+
+  m_intents.clear();
+  m_reducedDeferred.clear();
+  m_dormantDeferred.clear();
+  m_reducedCursor = 0;
+  m_dormantCursor = 0;
+
+  m_reservations.clear();
+}
+
+void ecs::EnemyControllerSystem::update(Registry& registry, const Configuration& config, const Entity tilemapEntity, const float dt)
 {
   using namespace ecs::npc;
 
@@ -76,20 +144,298 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
   const sf::Vector2i playerTile = tilemap->worldToTile(playerPos->position);
   if (!g.inBounds(playerTile.x, playerTile.y)) return;
 
-  static DistanceFieldCache distCache;
-  distCache.rebuildIfNeeded(*tilemap, g, playerTile);
+  const float dtSafe = std::max(0.f, dt);
+  const bool crowdSteering = config.crowd_steering == CrowdSteering::ORCA;
 
-  const std::unordered_set<int> initiallyOccupied = buildInitiallyOccupied(registry, g, *tilemap);
+  m_distCache.rebuildIfNeeded(*tilemap, g, playerTile);
 
-  std::vector<MoveReservation> reservations;
-  reservations.reserve(registry.entities().size());
+  const int visionRadius = maxVisionRangeTiles(registry);
+  m_visibility.update(*tilemap, g, playerTile, visionRadius);
 
-  const float dtSafe = std::max(0.f, dt);
+  m_navMesh.rebuildIfNeeded(*tilemap, g);
+  ++m_navTick;
+
+  sf::Vector2f playerFacing{};
+  if (const auto* playerRot = registry.getComponent<RotationComponent>(player))
+  {
+    const float angleRad = radiansFromDegrees(playerRot->angle);
+    playerFacing = { std::cos(angleRad), std::sin(angleRad) };
+  }
+
+  m_influence.begin(g, playerTile, visionRadius);
+  markInitiallyOccupied(registry, g, *tilemap, m_initiallyOccupied, m_influence);
+  m_influence.finish(*tilemap, g, m_visibility, playerFacing);
+
+  m_crowd.clear();
+  m_crowdAgents.clear();
+
+  if (crowdSteering)
+  {
+    for (const auto& e : registry.entities())
+    {
+      if (!registry.hasComponent<EnemyTag>(e)) continue;
+
+      const auto* pos = registry.getComponent<PositionComponent>(e);
+      const auto* vel = registry.getComponent<VelocityComponent>(e);
+      const auto* radius = registry.getComponent<RadiusComponent>(e);
+      if (!pos || !vel || !radius || !registry.hasComponent<SpeedComponent>(e) || !registry.hasComponent<EnemyComponent>(e)) continue;
+
+      m_crowd.addAgent(pos->position, vel->velocity, radius->radius);
+      m_crowdAgents.push_back(e);
+    }
+  }
+
+  m_intents.clear();
+  m_reducedDeferred.clear();
+  m_dormantDeferred.clear();
+
+  const auto schedule = [&](const Entity e, AiLodComponent* lod)
+  {
+    EnemyIntent intent;
+    intent.entity = e;
+    intent.thinkDt = dtSafe;
+    intent.previousThinkTick = m_navTick - 1;
+
+    if (lod)
+    {
+      intent.thinkDt = lod->secondsSinceThink;
+      intent.previousThinkTick = lod->lastThinkTick;
+      lod->secondsSinceThink = 0.f;
+      lod->lastThinkTick = m_navTick;
+      lod->steeringToTile = false;
+    }
+
+    m_intents.push_back(intent);
+  };
 
   for (const auto& e : registry.entities())
   {
     if (!registry.hasComponent<EnemyTag>(e)) continue;
 
+    auto* lod = registry.getComponent<AiLodComponent>(e);
+    const auto* pos = registry.getComponent<PositionComponent>(e);
+    const auto* enemy = registry.getComponent<EnemyComponent>(e);
+    if (!lod || !pos || !enemy)
+    {
+      schedule(e, nullptr);
+      continue;
+    }
+
+    lod->secondsSinceThink += dtSafe;
+
+    const sf::Vector2f toPlayer = playerPos->position - pos->position;
+    const float distTiles = std::hypot(toPlayer.x, toPlayer.y) / g.tileSize;
+    const sf::Vector2i enemyTile = tilemap->worldToTile(pos->position);
+    lod->tier = classifyLod(*enemy, distTiles, m_visibility.covers(enemyTile) && m_visibility.visible(g, enemyTile));
+
+    if (lod->tier == AiLodTier::FULL)
+    {
+      schedule(e, lod);
+      continue;
+    }
+
+    (lod->tier == AiLodTier::REDUCED ? m_reducedDeferred : m_dormantDeferred).push_back(e);
+  }
+
+  const auto admitDeferred = [&](const std::vector<Entity>& deferred, std::size_t& cursor, const float interval,
+                                 const unsigned quota)
+  {
+    if (deferred.empty()) return;
+
+    const std::size_t n = deferred.size();
+    cursor %= n;
+
+    unsigned admitted = 0;
+    std::size_t visited = 0;
+    for (; visited < n && admitted < quota; ++visited)
+    {
+      const Entity e = deferred[(cursor + visited) % n];
+      auto* lod = registry.getComponent<AiLodComponent>(e);
+      if (lod->secondsSinceThink < interval) continue;
+
+      schedule(e, lod);
+      ++admitted;
+    }
+
+    cursor = (cursor + visited) % n;
+  };
+
+  admitDeferred(m_reducedDeferred, m_reducedCursor, AI_LOD_REDUCED_INTERVAL_SECONDS, config.ai_reduced_thinks_per_step);
+  admitDeferred(m_dormantDeferred, m_dormantCursor, AI_LOD_DORMANT_INTERVAL_SECONDS, config.ai_dormant_thinks_per_step);
+
+  const auto holdTileSteering = [&](const std::vector<Entity>& deferred)
+  {
+    for (const Entity e : deferred)
+    {
+      auto* lod = registry.getComponent<AiLodComponent>(e);
+      if (lod->lastThinkTick == m_navTick || !lod->steeringToTile) continue;
+
+      const auto* pos = registry.getComponent<PositionComponent>(e);
+      auto* vel = registry.getComponent<VelocityComponent>(e);
+      const auto* speed = registry.getComponent<SpeedComponent>(e);
+      if (!pos || !vel || !speed) continue;
+
+      const sf::Vector2f toTarget = g.tileCenterWorld(lod->steerTile.x, lod->steerTile.y) - pos->position;
+      const float dist = std::hypot(toTarget.x, toTarget.y);
+      const float v = speed->speed * vel->velocityMultiplier;
+
+      if (!(v > 0.f) || dist <= v * dtSafe)
+      {
+        lod->steeringToTile = false;
+        setVelocityStop(*vel);
+        continue;
+      }
+
+      vel->velocity = toTarget * (v / dist);
+    }
+  };
+
+  holdTileSteering(m_reducedDeferred);
+  holdTileSteering(m_dormantDeferred);
+
+  const auto steerTowardPlayer = [&](const EnemyIntent& intent, const sf::Vector2f position, const float radius)
+  {
+    auto* path = registry.getComponent<NavPathComponent>(intent.entity);
+    if (!path) return sf::Vector2f{0.f, 0.f};
+
+    return steerAlongNavPath(m_navMesh, g, *path, position, playerPos->position, radius, intent.thinkDt, m_navTick,
+                             intent.previousThinkTick);
+  };
+
+  const auto decide = [&](EnemyIntent& intent)
+  {
+    const Entity e = intent.entity;
+    const auto* pos = registry.getComponent<PositionComponent>(e);
+    const auto* vel = registry.getComponent<VelocityComponent>(e);
+    const auto* speed = registry.getComponent<SpeedComponent>(e);
+    const auto* enemy = registry.getComponent<EnemyComponent>(e);
+
+    if (!pos || !vel || !speed || !enemy) return;
+
+    intent.perception = computePerception(registry, e, *pos, *enemy, *tilemap, m_visibility, *playerPos);
+    const PerceptionResult& perception = intent.perception;
+
+    if (!enemy->hasSeenPlayer && !perception.seesPlayerNow) return;
+
+    const float v = speed->speed * vel->velocityMultiplier;
+    if (!(v > 0.f)) return;
+
+    const auto moveAlong = [&](const sf::Vector2f dir)
+    {
+      intent.move = MoveIntent::VELOCITY;
+      intent.velocity = { dir.x * v, dir.y * v };
+    };
+
+    const sf::Vector2i enemyTile = tilemap->worldToTile(pos->position);
+    const bool enemyTileValid = g.inBounds(enemyTile.x, enemyTile.y);
+
+    const auto reserve = [&](const sf::Vector2i intended)
+    {
+      intent.move = MoveIntent::RESERVE;
+      intent.fromTile = enemyTile;
+      intent.intendedTile = intended;
+    };
+
+    const float enemyRadius = (registry.getComponent<RadiusComponent>(e) ? registry.getComponent<RadiusComponent>(e)->radius : 0.f);
+
+    if (enemy->cls == EnemyClass::MELEE || !perception.seesPlayerNow)
+    {
+      if (perception.los)
+      {
+        moveAlong(perception.toPlayerDir);
+        return;
+      }
+
+      if (!enemyTileValid) return;
+
+      if (const sf::Vector2f dir = steerTowardPlayer(intent, pos->position, enemyRadius); dir.x != 0.f || dir.y != 0.f)
+      {
+        moveAlong(dir);
+        return;
+      }
+
+      reserve(pickNextTileToward(g, m_distCache, m_initiallyOccupied, enemyTile, playerTile));
+      return;
+    }
+
+    const float desired = enemy->rangedPreferredRangeTiles;
+    const float tol = enemy->rangedRangeToleranceTiles;
+
+    const bool tooFar = perception.distTilesEuclid > desired + tol;
+    const bool tooClose = perception.distTilesEuclid < desired - tol;
+
+    if (perception.los)
+    {
+      if (tooFar)
+      {
+        moveAlong(perception.toPlayerDir);
+        return;
+      }
+
+      if (tooClose)
+      {
+        moveAlong(-perception.toPlayerDir);
+        return;
+      }
+
+      const bool clockwise = (entityIndex(e) % 2 == 0);
+      moveAlong(perpendicularStrafeDir(perception.toPlayerDir, clockwise));
+      return;
+    }
+
+    if (!enemyTileValid) return;
+
+    if (tooFar)
+    {
+      if (const sf::Vector2f dir = steerTowardPlayer(intent, pos->position, enemyRadius); dir.x != 0.f || dir.y != 0.f)
+      {
+        moveAlong(dir);
+        return;
+      }
+
+      reserve(pickNextTileToward(g, m_distCache, m_initiallyOccupied, enemyTile, playerTile));
+      return;
+    }
+
+    if (tooClose)
+    {
+      reserve(pickNextTileAway(g, m_distCache, m_initiallyOccupied, m_influence, enemyTile));
+      return;
+    }
+
+    const bool clockwise = (entityIndex(e) % 2 == 0);
+    reserve(pickOrbitTile(
+      g,
+      m_initiallyOccupied,
+      m_influence,
+      enemyTile,
+      pos->position,
+      playerPos->position,
+      desired,
+      tol,
+      perception.toPlayerDir,
+      clockwise,
+      DEFAULT_ORBIT_TUNING
+    ));
+  };
+
+  if (m_intents.size() >= static_cast<std::size_t>(ENEMY_DECIDE_PARALLEL_MIN_ENEMIES))
+  {
+    m_workers.parallelFor(m_intents.size(), [&](const std::size_t i) { decide(m_intents[i]); });
+  }
+  else
+  {
+    for (auto& intent : m_intents) decide(intent);
+  }
+
+  m_reservations.clear();
+
+  for (const auto& intent : m_intents)
+  {
+    const Entity e = intent.entity;
+    const float thinkDt = intent.thinkDt;
+    const PerceptionResult& perception = intent.perception;
+
     auto* pos = registry.getComponent<PositionComponent>(e);
     auto* vel = registry.getComponent<VelocityComponent>(e);
     const auto* speed = registry.getComponent<SpeedComponent>(e);
@@ -98,9 +444,7 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
 
     if (!pos || !vel || !speed || !enemy || !sprite) continue;
 
-    enemy->cooldownRemainingSeconds = std::max(0.f, enemy->cooldownRemainingSeconds - dtSafe);
-
-    const PerceptionResult perception = computePerception(registry, e, *pos, *enemy, *tilemap, *playerPos);
+    enemy->cooldownRemainingSeconds = std::max(0.f, enemy->cooldownRemainingSeconds - thinkDt);
 
     if (!enemy->hasSeenPlayer && perception.seesPlayerNow)
     {
@@ -117,7 +461,7 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
 
     if ((enemy->cls == EnemyClass::RANGE || enemy->cls == EnemyClass::SUPPORT) && enemy->rangedDodgeActive)
     {
-      enemy->rangedDodgeTimeRemainingSeconds = std::max(0.f, enemy->rangedDodgeTimeRemainingSeconds - dtSafe);
+      enemy->rangedDodgeTimeRemainingSeconds = std::max(0.f, enemy->rangedDodgeTimeRemainingSeconds - thinkDt);
 
       if (const float v = speed->speed * vel->velocityMultiplier; !(v > 0.f))
       {
@@ -131,7 +475,7 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
         const auto step = sf::Vector2f{dir.x * v, dir.y * v};
 
         const float r = (registry.getComponent<RadiusComponent>(e) ? registry.getComponent<RadiusComponent>(e)->radius : 0.f);
-        const auto nextPos = sf::Vector2f{pos->position.x + step.x * dtSafe, pos->position.y + step.y * dtSafe};
+        const auto nextPos = sf::Vector2f{pos->position.x + step.x * thinkDt, pos->position.y + step.y * thinkDt};
 
         if (CollisionSystem::checkWallCollision(registry, nextPos, r, tilemapEntity))
         {
@@ -163,7 +507,7 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
 
     const float enemyRadius = (registry.getComponent<RadiusComponent>(e) ? registry.getComponent<RadiusComponent>(e)->radius : 0.f);
 
-    if (updateCombat(registry, tilemapEntity, e, pos->position, enemyRadius, *enemy, *sprite, *vel, *playerHealth, perception, g.tileSize, dtSafe))
+    if (updateCombat(registry, tilemapEntity, e, pos->position, enemyRadius, *enemy, *sprite, *vel, *playerHealth, perception, g.tileSize, thinkDt))
     {
       continue;
     }
@@ -173,142 +517,28 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
       enterMoving(*enemy, *sprite);
     }
 
-    const float v = speed->speed * vel->velocityMultiplier;
-    if (!(v > 0.f))
-    {
-      setVelocityStop(*vel);
-      continue;
-    }
-
-    const sf::Vector2i enemyTile = tilemap->worldToTile(pos->position);
-    const bool enemyTileValid = g.inBounds(enemyTile.x, enemyTile.y);
-
-    if (enemy->cls == EnemyClass::MELEE)
+    if (intent.move == MoveIntent::VELOCITY)
     {
-      if (perception.los)
-      {
-        vel->velocity = { perception.toPlayerDir.x * v, perception.toPlayerDir.y * v };
-        continue;
-      }
-
-      if (!enemyTileValid)
-      {
-        setVelocityStop(*vel);
-        continue;
-      }
-
-      const sf::Vector2i intended = pickNextTileToward(g, distCache.field(), initiallyOccupied, enemyTile, playerTile);
-
-      MoveReservation r;
-      r.entity = e;
-      r.fromTile = enemyTile;
-      r.intendedTile = intended;
-      r.wantsMove = true;
-      reservations.push_back(r);
-
-      setVelocityStop(*vel);
+      vel->velocity = intent.velocity;
       continue;
     }
 
-    if (!perception.seesPlayerNow)
+    if (intent.move == MoveIntent::RESERVE)
     {
-      if (perception.los)
-      {
-        vel->velocity = { perception.toPlayerDir.x * v, perception.toPlayerDir.y * v };
-        continue;
-      }
-
-      if (!enemyTileValid)
-      {
-        setVelocityStop(*vel);
-        continue;
-      }
-
-      const sf::Vector2i intended = pickNextTileToward(g, distCache.field(), initiallyOccupied, enemyTile, playerTile);
-
       MoveReservation r;
       r.entity = e;
-      r.fromTile = enemyTile;
-      r.intendedTile = intended;
+      r.fromTile = intent.fromTile;
+      r.intendedTile = intent.intendedTile;
       r.wantsMove = true;
-      reservations.push_back(r);
-
-      setVelocityStop(*vel);
-      continue;
-    }
-
-    const float desired = enemy->rangedPreferredRangeTiles;
-    const float tol = enemy->rangedRangeToleranceTiles;
-
-    const bool tooFar = perception.distTilesEuclid > desired + tol;
-    const bool tooClose = perception.distTilesEuclid < desired - tol;
-
-    if (perception.los)
-    {
-      if (tooFar)
-      {
-        vel->velocity = { perception.toPlayerDir.x * v, perception.toPlayerDir.y * v };
-        continue;
-      }
-
-      if (tooClose)
-      {
-        vel->velocity = { -perception.toPlayerDir.x * v, -perception.toPlayerDir.y * v };
-        continue;
-      }
-
-      const bool clockwise = (entityIndex(e) % 2 == 0);
-      const sf::Vector2f perp = perpendicularStrafeDir(perception.toPlayerDir, clockwise);
-      vel->velocity = { perp.x * v, perp.y * v };
-      continue;
-    }
-
-    if (!enemyTileValid)
-    {
-      setVelocityStop(*vel);
-      continue;
-    }
-
-    sf::Vector2i intended = enemyTile;
-    const bool clockwise = (entityIndex(e) % 2 == 0);
-
-    if (tooFar)
-    {
-      intended = pickNextTileToward(g, distCache.field(), initiallyOccupied, enemyTile, playerTile);
-    }
-    else if (tooClose)
-    {
-      intended = pickNextTileAway(g, distCache.field(), initiallyOccupied, enemyTile);
-    }
-    else
-    {
-      intended = pickOrbitTile(
-        g,
-        initiallyOccupied,
-        enemyTile,
-        pos->position,
-        playerPos->position,
-        desired,
-        tol,
-        perception.toPlayerDir,
-        clockwise,
-        DEFAULT_ORBIT_TUNING
-      );
+      m_reservations.push_back(r);
     }
 
-    MoveReservation r;
-    r.entity = e;
-    r.fromTile = enemyTile;
-    r.intendedTile = intended;
-    r.wantsMove = true;
-    reservations.push_back(r);
-
     setVelocityStop(*vel);
   }
 
-  resolveMoveReservations(g, initiallyOccupied, reservations);
+  resolveMoveReservations(g, m_initiallyOccupied, m_reservations);
 
-  for (const auto& r : reservations)
+  for (const auto& r : m_reservations)
   {
     if (!r.wantsMove) continue;
 
@@ -327,14 +557,86 @@ void ecs::EnemyControllerSystem::update(Registry& registry, const Entity tilemap
       continue;
     }
 
-    if (r.finalTile == r.fromTile)
+    const bool yielded = r.finalTile == r.fromTile;
+    const bool pressOn = crowdSteering && r.intendedTile != r.fromTile
+      && g.inBounds(r.intendedTile.x, r.intendedTile.y) && !g.blocked(r.intendedTile.x, r.intendedTile.y);
+    if (yielded && !pressOn)
     {
       setVelocityStop(*vel);
       continue;
     }
 
-    const sf::Vector2f target = g.tileCenterWorld(r.finalTile.x, r.finalTile.y);
+    const sf::Vector2i targetTile = yielded ? r.intendedTile : r.finalTile;
+    const sf::Vector2f target = g.tileCenterWorld(targetTile.x, targetTile.y);
     const sf::Vector2f dir = normalizedOrZero(target - pos->position);
     vel->velocity = { dir.x * v, dir.y * v };
+
+    if (auto* lod = registry.getComponent<AiLodComponent>(r.entity))
+    {
+      lod->steeringToTile = true;
+      lod->steerTile = targetTile;
+    }
+  }
+
+  if (crowdSteering && dtSafe > 0.f && !m_crowdAgents.empty())
+  {
+    m_thoughtThisStep.assign(m_thoughtThisStep.size(), 0);
+    m_solved.clear();
+
+    for (const auto& intent : m_intents)
+    {
+      const std::size_t index = entityIndex(intent.entity);
+      if (index >= m_thoughtThisStep.size()) m_thoughtThisStep.resize(index + 1, 0);
+      m_thoughtThisStep[index] = 1;
+    }
+
+    for (std::size_t i = 0; i < m_crowdAgents.size(); ++i)
+    {
+      const auto* vel = registry.getComponent<VelocityComponent>(m_crowdAgents[i]);
+      const auto* speed = registry.getComponent<SpeedComponent>(m_crowdAgents[i]);
+      const auto* enemy = registry.getComponent<EnemyComponent>(m_crowdAgents[i]);
+
+      const std::size_t index = entityIndex(m_crowdAgents[i]);
+      const bool thought = index < m_thoughtThisStep.size() && m_thoughtThisStep[index];
+      const bool holdsPosition = !thought || !enemy->hasSeenPlayer
+        || (enemy->state == EnemyState::ATTACKING && !enemy->rangedDodgeActive);
+      const float maxSpeed = holdsPosition
+        ? 0.f
+        : std::max(speed->speed * vel->velocityMultiplier, std::hypot(vel->velocity.x, vel->velocity.y));
+      m_crowd.setPreferredVelocity(i, vel->velocity, maxSpeed);
+
+      if (thought) m_solved.push_back(i);
+    }
+
+    m_crowd.buildIndex(CROWD_NEIGHBOUR_DIST_TILES * g.tileSize);
+
+    const auto avoid = [&](const std::size_t k)
+    {
+      m_crowd.computeVelocity(m_solved[k], CROWD_TIME_HORIZON_SECONDS, dtSafe, CROWD_MAX_NEIGHBOURS);
+    };
+
+    if (m_solved.size() >= static_cast<std::size_t>(ENEMY_DECIDE_PARALLEL_MIN_ENEMIES))
+    {
+      m_workers.parallelFor(m_solved.size(), avoid);
+    }
+    else
+    {
+      for (std::size_t k = 0; k < m_solved.size(); ++k) avoid(k);
+    }
+
+    for (const std::size_t i : m_solved)
+    {
+      const Entity e = m_crowdAgents[i];
+      const auto* pos = registry.getComponent<PositionComponent>(e);
+      const auto* radius = registry.getComponent<RadiusComponent>(e);
+      auto* vel = registry.getComponent<VelocityComponent>(e);
+
+      const sf::Vector2f avoided = m_crowd.velocity(i);
+      const sf::Vector2f nextPos = pos->position + avoided * dtSafe;
+      if (CollisionSystem::checkWallCollision(registry, nextPos, radius->radius, tilemapEntity)) continue;
+
+      vel->velocity = avoided;
+    }
   }
+
 }
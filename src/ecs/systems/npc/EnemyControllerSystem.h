@@ -4,16 +4,79 @@
 
 #ifndef NULLP0INT_PATHFINDINGSYSTEM_H
 #define NULLP0INT_PATHFINDINGSYSTEM_H
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
 #include "../../Registry.h"
+#include "../../../configuration/Configuration.h"
+
+#include "PathfindingCrowd.h"
+#include "PathfindingDistanceField.h"
+#include "PathfindingInfluence.h"
+#include "PathfindingNavMesh.h"
+#include "PathfindingOccupancy.h"
+#include "PathfindingPerception.h"
+#include "PathfindingReservation.h"
+#include "PathfindingVisibility.h"
+#include "WorkerPool.h"
 
 namespace ecs
 {
   class EnemyControllerSystem
   {
   public:
-    static void update(Registry& registry, Entity tilemapEntity, float dt);
+    EnemyControllerSystem();
+
+    void update(Registry& registry, const Configuration& config, Entity tilemapEntity, float dt);
+    void reset();
+
+  private:
+    enum class MoveIntent
+    {
+      STOP,
+      VELOCITY,
+      RESERVE,
+    };
+
+    struct EnemyIntent
+    {
+      Entity entity = INVALID_ENTITY;
+      float thinkDt = 0.f;
+      std::uint32_t previousThinkTick = 0;
+
+      npc::PerceptionResult perception{};
+      MoveIntent move = MoveIntent::STOP;
+      sf::Vector2f velocity{};
+      sf::Vector2i fromTile{};
+      sf::Vector2i intendedTile{};
+    };
+
+    npc::DistanceFieldCache m_distCache;
+    npc::VisibilityField m_visibility;
+    npc::NavMesh m_navMesh;
+    std::uint32_t m_navTick = 0;
+    npc::OccupancyGrid m_initiallyOccupied;
+    npc::InfluenceMap m_influence;
+
+    npc::CrowdSimulation m_crowd;
+    std::vector<Entity> m_crowdAgents;
+    std::vector<std::uint8_t> m_thoughtThisStep;
+    std::vector<std::size_t> m_solved;
+
+    std::vector<EnemyIntent> m_intents;
+    std::vector<Entity> m_reducedDeferred;
+    std::vector<Entity> m_dormantDeferred;
+    std::size_t m_reducedCursor = 0;
+    std::size_t m_dormantCursor = 0;
+
+    std::vector<npc::MoveReservation> m_reservations;
+
+    npc::WorkerPool m_workers;
   };
 }
 
 
-#endif //NULLP0INT_PATHFINDINGSYSTEM_H
\ No newline at end of file
+#endif //NULLP0INT_PATHFINDINGSYSTEM_H
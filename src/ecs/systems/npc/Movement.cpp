@@ -4,29 +4,36 @@
 
 #include "Movement.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include "../../../constants.h"
 
 namespace ecs::npc
 {
-  static const sf::Vector2i kDirs8[8] = {
-    { 1,  0}, {-1,  0}, { 0,  1}, { 0, -1},
-    { 1,  1}, { 1, -1}, {-1,  1}, {-1, -1}
-  };
-
   sf::Vector2i pickNextTileToward(
     const Grid& g,
-    const std::vector<int>& distField,
-    const std::unordered_set<int>& occupied,
+    const DistanceFieldCache& distCache,
+    const OccupancyGrid& occupied,
     const sf::Vector2i curTile,
     const sf::Vector2i playerTile
   )
   {
     if (!g.inBounds(curTile.x, curTile.y)) return curTile;
 
+    const std::vector<int>& distField = distCache.field();
     const int curIndex = g.idx(curTile.x, curTile.y);
     const int curDist = distField[curIndex];
     if (curDist < 0) return curTile;
 
+    const std::uint8_t step = distCache.towardStep(curIndex);
+    if (step == DistanceFieldCache::NO_STEP) return curTile;
+
+    const sf::Vector2i preferred = curTile + kDirs8[step];
+    if (preferred == playerTile || !occupied.contains(g.idx(preferred.x, preferred.y))) return preferred;
+
     sf::Vector2i best = curTile;
     int bestDist = curDist;
 
@@ -62,18 +69,29 @@ namespace ecs::npc
 
   sf::Vector2i pickNextTileAway(
     const Grid& g,
-    const std::vector<int>& distField,
-    const std::unordered_set<int>& occupied,
+    const DistanceFieldCache& distCache,
+    const OccupancyGrid& occupied,
+    const InfluenceMap& influence,
     const sf::Vector2i curTile
   )
   {
     if (!g.inBounds(curTile.x, curTile.y)) return curTile;
+
+    const std::vector<int>& distField = distCache.field();
     const int curIndex = g.idx(curTile.x, curTile.y);
     const int curDist = distField[curIndex];
     if (curDist < 0) return curTile;
 
+    const std::uint8_t step = distCache.awayStep(curIndex);
+    if (step == DistanceFieldCache::NO_STEP) return curTile;
+
+    const sf::Vector2i preferred = curTile + kDirs8[step];
+    const bool tactical = influence.covers(curTile);
+    if (!tactical && !occupied.contains(g.idx(preferred.x, preferred.y))) return preferred;
+
     sf::Vector2i best = curTile;
     int bestDist = curDist;
+    float bestCost = std::numeric_limits<float>::infinity();
 
     for (const auto d : kDirs8)
     {
@@ -91,10 +109,21 @@ namespace ecs::npc
       const int nIndex = g.idx(nx, ny);
       const int nd = distField[nIndex];
       if (nd < 0) continue;
-      if (nd <= bestDist) continue;
-
       if (occupied.contains(nIndex) && nIndex != curIndex) continue;
 
+      if (tactical)
+      {
+        if (nd <= curDist) continue;
+
+        const float cost = influence.tacticalCost({nx, ny}) - static_cast<float>(nd - curDist);
+        if (cost >= bestCost) continue;
+        bestCost = cost;
+      }
+      else if (nd <= bestDist)
+      {
+        continue;
+      }
+
       bestDist = nd;
       best = {nx, ny};
     }
@@ -102,6 +131,51 @@ namespace ecs::npc
     return best;
   }
 
+  sf::Vector2f steerAlongNavPath(
+    const NavMesh& navMesh,
+    const Grid& g,
+    NavPathComponent& path,
+    const sf::Vector2f position,
+    const sf::Vector2f goal,
+    const float radius,
+    const float dt,
+    const std::uint32_t tick,
+    const std::uint32_t previousThinkTick
+  )
+  {
+    const bool resumed = path.lastFollowTick != previousThinkTick;
+    path.lastFollowTick = tick;
+    path.replanTimerSeconds -= dt;
+
+    const sf::Vector2i goalTile{
+      static_cast<int>(goal.x / g.tileSize),
+      static_cast<int>(goal.y / g.tileSize)
+    };
+    const int goalDrift = std::max(std::abs(goalTile.x - path.goalTile.x), std::abs(goalTile.y - path.goalTile.y));
+
+    const bool needsPath = path.waypoints.empty() && !path.unreachable;
+    if (resumed || goalDrift > NAV_REPLAN_GOAL_DRIFT_TILES || path.replanTimerSeconds <= 0.f || needsPath)
+    {
+      path.next = 0;
+      path.goalTile = goalTile;
+      path.replanTimerSeconds = NAV_REPLAN_INTERVAL_SECONDS;
+      path.unreachable = !navMesh.findPath(g, position, goal, radius, path.waypoints);
+      if (path.unreachable) path.waypoints.clear();
+    }
+
+    if (path.waypoints.empty()) return {0.f, 0.f};
+
+    const float reach = NAV_WAYPOINT_REACHED_TILES * g.tileSize;
+    while (path.next + 1 < path.waypoints.size())
+    {
+      const sf::Vector2f toWaypoint = path.waypoints[path.next] - position;
+      if (std::hypot(toWaypoint.x, toWaypoint.y) > reach) break;
+      ++path.next;
+    }
+
+    return normalizedOrZero(path.waypoints[path.next] - position);
+  }
+
   sf::Vector2f perpendicularStrafeDir(const sf::Vector2f toPlayerDir, const bool clockwise)
   {
     return clockwise
@@ -111,7 +185,8 @@ namespace ecs::npc
 
   sf::Vector2i pickOrbitTile(
     const Grid& g,
-    const std::unordered_set<int>& occupied,
+    const OccupancyGrid& occupied,
+    const InfluenceMap& influence,
     const sf::Vector2i curTile,
     const sf::Vector2f curWorld,
     const sf::Vector2f playerWorld,
@@ -172,7 +247,8 @@ namespace ecs::npc
         rangeErr * tuning.rangeWeight +
         tangentialScore * tuning.tangentialWeight +
         wrongSide +
-        driftPenalty;
+        driftPenalty +
+        influence.tacticalCost({nx, ny});
 
       if (score < bestScore)
       {
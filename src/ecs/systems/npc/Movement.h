@@ -5,33 +5,39 @@
 #ifndef NULLP0INT_MOVEMENT_H
 #define NULLP0INT_MOVEMENT_H
 
-#include <unordered_set>
+#include <cstdint>
 #include <vector>
 
 #include <SFML/System/Vector2.hpp>
 
+#include "PathfindingDistanceField.h"
+#include "PathfindingInfluence.h"
+#include "PathfindingNavMesh.h"
+#include "PathfindingOccupancy.h"
 #include "PathfindingTypes.h"
 
 namespace ecs::npc
 {
   [[nodiscard]] sf::Vector2i pickNextTileToward(
     const Grid& g,
-    const std::vector<int>& distField,
-    const std::unordered_set<int>& occupied,
+    const DistanceFieldCache& distCache,
+    const OccupancyGrid& occupied,
     sf::Vector2i curTile,
     sf::Vector2i playerTile
   );
 
   [[nodiscard]] sf::Vector2i pickNextTileAway(
     const Grid& g,
-    const std::vector<int>& distField,
-    const std::unordered_set<int>& occupied,
+    const DistanceFieldCache& distCache,
+    const OccupancyGrid& occupied,
+    const InfluenceMap& influence,
     sf::Vector2i curTile
   );
 
   [[nodiscard]] sf::Vector2i pickOrbitTile(
     const Grid& g,
-    const std::unordered_set<int>& occupied,
+    const OccupancyGrid& occupied,
+    const InfluenceMap& influence,
     sf::Vector2i curTile,
     sf::Vector2f curWorld,
     sf::Vector2f playerWorld,
@@ -42,6 +48,18 @@ namespace ecs::npc
     const OrbitTuning& tuning = DEFAULT_ORBIT_TUNING
   );
 
+  [[nodiscard]] sf::Vector2f steerAlongNavPath(
+    const NavMesh& navMesh,
+    const Grid& g,
+    NavPathComponent& path,
+    sf::Vector2f position,
+    sf::Vector2f goal,
+    float radius,
+    float dt,
+    std::uint32_t tick,
+    std::uint32_t previousThinkTick
+  );
+
   [[nodiscard]] sf::Vector2f perpendicularStrafeDir(sf::Vector2f toPlayerDir, bool clockwise);
 }
 
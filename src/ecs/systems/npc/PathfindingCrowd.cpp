@@ -0,0 +1,324 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "PathfindingCrowd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+  constexpr float kLpEpsilon = 1e-5f;
+
+  struct Line
+  {
+    sf::Vector2f point{};
+    sf::Vector2f direction{};
+  };
+
+  [[nodiscard]] float dot(const sf::Vector2f a, const sf::Vector2f b)
+  {
+    return a.x * b.x + a.y * b.y;
+  }
+
+  [[nodiscard]] float det(const sf::Vector2f a, const sf::Vector2f b)
+  {
+    return a.x * b.y - a.y * b.x;
+  }
+
+  [[nodiscard]] float lengthSq(const sf::Vector2f v)
+  {
+    return dot(v, v);
+  }
+
+  [[nodiscard]] sf::Vector2f normalized(const sf::Vector2f v)
+  {
+    const float len = std::sqrt(lengthSq(v));
+    return len > 0.f ? v / len : sf::Vector2f{0.f, 0.f};
+  }
+
+  bool solveOnLine(const std::vector<Line>& lines, const std::size_t lineNo, const float radius,
+                      const sf::Vector2f optVelocity, const bool directionOpt, sf::Vector2f& result)
+  {
+    const Line& line = lines[lineNo];
+    const float dotProduct = dot(line.point, line.direction);
+    const float discriminant = dotProduct * dotProduct + radius * radius - lengthSq(line.point);
+    if (discriminant < 0.f) return false;
+
+    const float sqrtDiscriminant = std::sqrt(discriminant);
+    float tLeft = -dotProduct - sqrtDiscriminant;
+    float tRight = -dotProduct + sqrtDiscriminant;
+
+    for (std::size_t i = 0; i < lineNo; ++i)
+    {
+      const float denominator = det(line.direction, lines[i].direction);
+      const float numerator = det(lines[i].direction, line.point - lines[i].point);
+
+      if (std::abs(denominator) <= kLpEpsilon)
+      {
+        if (numerator < 0.f) return false;
+        continue;
+      }
+
+      const float t = numerator / denominator;
+      if (denominator >= 0.f) tRight = std::min(tRight, t);
+      else tLeft = std::max(tLeft, t);
+
+      if (tLeft > tRight) return false;
+    }
+
+    if (directionOpt)
+    {
+      result = line.point + line.direction * (dot(optVelocity, line.direction) > 0.f ? tRight : tLeft);
+      return true;
+    }
+
+    const float t = std::clamp(dot(line.direction, optVelocity - line.point), tLeft, tRight);
+    result = line.point + line.direction * t;
+    return true;
+  }
+
+  std::size_t firstUnsatisfiedLine(const std::vector<Line>& lines, const float radius, const sf::Vector2f optVelocity,
+                             const bool directionOpt, sf::Vector2f& result)
+  {
+    if (directionOpt) result = optVelocity * radius;
+    else if (lengthSq(optVelocity) > radius * radius) result = normalized(optVelocity) * radius;
+    else result = optVelocity;
+
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      if (det(lines[i].direction, lines[i].point - result) <= 0.f) continue;
+
+      const sf::Vector2f previous = result;
+      if (!solveOnLine(lines, i, radius, optVelocity, directionOpt, result))
+      {
+        result = previous;
+        return i;
+      }
+    }
+
+    return lines.size();
+  }
+
+  void minimiseLargestViolation(const std::vector<Line>& lines, const std::size_t beginLine, const float radius,
+                      std::vector<Line>& projected, sf::Vector2f& result)
+  {
+    float distance = 0.f;
+
+    for (std::size_t i = beginLine; i < lines.size(); ++i)
+    {
+      if (det(lines[i].direction, lines[i].point - result) <= distance) continue;
+
+      projected.clear();
+      for (std::size_t j = 0; j < i; ++j)
+      {
+        Line line;
+        const float determinant = det(lines[i].direction, lines[j].direction);
+
+        if (std::abs(determinant) <= kLpEpsilon)
+        {
+          if (dot(lines[i].direction, lines[j].direction) > 0.f) continue;
+          line.point = (lines[i].point + lines[j].point) * 0.5f;
+        }
+        else
+        {
+          line.point = lines[i].point
+            + lines[i].direction * (det(lines[j].direction, lines[i].point - lines[j].point) / determinant);
+        }
+
+        line.direction = normalized(lines[j].direction - lines[i].direction);
+        projected.push_back(line);
+      }
+
+      const sf::Vector2f previous = result;
+      const sf::Vector2f away{-lines[i].direction.y, lines[i].direction.x};
+      if (firstUnsatisfiedLine(projected, radius, away, true, result) < projected.size())
+      {
+        result = previous;
+      }
+
+      distance = det(lines[i].direction, lines[i].point - result);
+    }
+  }
+}
+
+namespace ecs::npc
+{
+  std::size_t CrowdSimulation::addAgent(const sf::Vector2f position, const sf::Vector2f velocity, const float radius)
+  {
+    Agent a;
+    a.position = position;
+    a.velocity = velocity;
+    a.newVelocity = velocity;
+    a.radius = radius;
+    m_agents.push_back(a);
+    return m_agents.size() - 1;
+  }
+
+  void CrowdSimulation::setPreferredVelocity(const std::size_t agent, const sf::Vector2f preferred, const float maxSpeed)
+  {
+    Agent& a = m_agents[agent];
+    a.preferred = preferred;
+    a.maxSpeed = std::max(0.f, maxSpeed);
+    a.newVelocity = preferred;
+  }
+
+  void CrowdSimulation::buildIndex(const float neighbourDist)
+  {
+    m_cellSize = std::max(neighbourDist, 1.f);
+
+    std::uint32_t buckets = 16;
+    while (buckets < 2 * m_agents.size()) buckets <<= 1;
+    m_bucketMask = buckets - 1;
+
+    m_bucketStart.assign(buckets + 1, 0);
+    for (const Agent& a : m_agents) ++m_bucketStart[bucketOf(cellOf(a.position)) + 1];
+    for (std::uint32_t b = 0; b < buckets; ++b) m_bucketStart[b + 1] += m_bucketStart[b];
+
+    m_bucketAgents.resize(m_agents.size());
+    for (std::uint32_t i = 0; i < m_agents.size(); ++i)
+    {
+      std::uint32_t& slot = m_bucketStart[bucketOf(cellOf(m_agents[i].position))];
+      m_bucketAgents[slot++] = i;
+    }
+
+    for (std::uint32_t b = buckets; b > 0; --b) m_bucketStart[b] = m_bucketStart[b - 1];
+    m_bucketStart[0] = 0;
+  }
+
+  void CrowdSimulation::computeVelocity(const std::size_t agent, const float timeHorizon, const float dt,
+                                        const int maxNeighbours)
+  {
+    Agent& self = m_agents[agent];
+    if (!(self.maxSpeed > 0.f) || !(dt > 0.f) || !(timeHorizon > 0.f))
+    {
+      self.newVelocity = {0.f, 0.f};
+      return;
+    }
+
+    thread_local std::vector<std::pair<float, std::uint32_t>> neighbours;
+    thread_local std::vector<Line> lines;
+    thread_local std::vector<Line> projected;
+    neighbours.clear();
+    lines.clear();
+
+    const float rangeSq = m_cellSize * m_cellSize;
+    const sf::Vector2i cell = cellOf(self.position);
+
+    std::uint32_t visited[9];
+    int visitedCount = 0;
+    for (int dy = -1; dy <= 1; ++dy)
+    {
+      for (int dx = -1; dx <= 1; ++dx)
+      {
+        const std::uint32_t bucket = bucketOf({cell.x + dx, cell.y + dy});
+        if (std::find(visited, visited + visitedCount, bucket) != visited + visitedCount) continue;
+        visited[visitedCount++] = bucket;
+
+        for (std::uint32_t k = m_bucketStart[bucket]; k < m_bucketStart[bucket + 1]; ++k)
+        {
+          const std::uint32_t other = m_bucketAgents[k];
+          if (other == agent) continue;
+
+          const float distSq = lengthSq(m_agents[other].position - self.position);
+          if (distSq >= rangeSq) continue;
+
+          if (static_cast<int>(neighbours.size()) == maxNeighbours)
+          {
+            if (distSq >= neighbours.back().first) continue;
+            neighbours.pop_back();
+          }
+
+          const auto at = std::ranges::upper_bound(neighbours, distSq, {}, &std::pair<float, std::uint32_t>::first);
+          neighbours.emplace(at, distSq, other);
+        }
+      }
+    }
+
+    const float invTimeHorizon = 1.f / timeHorizon;
+    for (const auto& [distSq, otherIndex] : neighbours)
+    {
+      const Agent& other = m_agents[otherIndex];
+      const sf::Vector2f relPos = other.position - self.position;
+      const sf::Vector2f relVel = self.velocity - other.velocity;
+      const float combinedRadius = self.radius + other.radius;
+      const float combinedRadiusSq = combinedRadius * combinedRadius;
+      const float responsibility = other.maxSpeed > 0.f ? 0.5f : 1.f;
+
+      Line line;
+      sf::Vector2f u;
+
+      if (distSq > combinedRadiusSq)
+      {
+        const sf::Vector2f w = relVel - relPos * invTimeHorizon;
+        const float wLengthSq = lengthSq(w);
+        const float dotProduct = dot(w, relPos);
+
+        if (dotProduct < 0.f && dotProduct * dotProduct > combinedRadiusSq * wLengthSq)
+        {
+          const float wLength = std::sqrt(wLengthSq);
+          const sf::Vector2f unitW = w / wLength;
+          line.direction = {unitW.y, -unitW.x};
+          u = unitW * (combinedRadius * invTimeHorizon - wLength);
+        }
+        else
+        {
+          const float leg = std::sqrt(distSq - combinedRadiusSq);
+          if (det(relPos, w) > 0.f)
+          {
+            line.direction = sf::Vector2f{
+              relPos.x * leg - relPos.y * combinedRadius,
+              relPos.x * combinedRadius + relPos.y * leg
+            } / distSq;
+          }
+          else
+          {
+            line.direction = -sf::Vector2f{
+              relPos.x * leg + relPos.y * combinedRadius,
+              -relPos.x * combinedRadius + relPos.y * leg
+            } / distSq;
+          }
+
+          u = line.direction * dot(relVel, line.direction) - relVel;
+        }
+      }
+      else
+      {
+        const float invDt = 1.f / dt;
+        const sf::Vector2f w = relVel - relPos * invDt;
+        const float wLength = std::sqrt(lengthSq(w));
+        const sf::Vector2f unitW = wLength > 0.f ? w / wLength : sf::Vector2f{1.f, 0.f};
+        line.direction = {unitW.y, -unitW.x};
+        u = unitW * (combinedRadius * invDt - wLength);
+      }
+
+      line.point = self.velocity + u * responsibility;
+      lines.push_back(line);
+    }
+
+    sf::Vector2f result;
+    if (const std::size_t failed = firstUnsatisfiedLine(lines, self.maxSpeed, self.preferred, false, result); failed < lines.size())
+    {
+      minimiseLargestViolation(lines, failed, self.maxSpeed, projected, result);
+    }
+
+    self.newVelocity = result;
+  }
+
+  sf::Vector2i CrowdSimulation::cellOf(const sf::Vector2f p) const
+  {
+    return {
+      static_cast<int>(std::floor(p.x / m_cellSize)),
+      static_cast<int>(std::floor(p.y / m_cellSize))
+    };
+  }
+
+  std::uint32_t CrowdSimulation::bucketOf(const sf::Vector2i cell) const
+  {
+    const auto hx = static_cast<std::uint32_t>(cell.x) * 73856093u;
+    const auto hy = static_cast<std::uint32_t>(cell.y) * 19349663u;
+    return (hx ^ hy) & m_bucketMask;
+  }
+}
@@ -0,0 +1,52 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_PATHFINDINGCROWD_H
+#define NULLP0INT_PATHFINDINGCROWD_H
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+namespace ecs::npc
+{
+  class CrowdSimulation
+  {
+  public:
+    void clear() { m_agents.clear(); }
+
+    std::size_t addAgent(sf::Vector2f position, sf::Vector2f velocity, float radius);
+    void setPreferredVelocity(std::size_t agent, sf::Vector2f preferred, float maxSpeed);
+
+    void buildIndex(float neighbourDist);
+    void computeVelocity(std::size_t agent, float timeHorizon, float dt, int maxNeighbours);
+
+    [[nodiscard]] std::size_t agentCount() const { return m_agents.size(); }
+    [[nodiscard]] sf::Vector2f velocity(const std::size_t agent) const { return m_agents[agent].newVelocity; }
+
+  private:
+    struct Agent
+    {
+      sf::Vector2f position{};
+      sf::Vector2f velocity{};
+      sf::Vector2f preferred{};
+      sf::Vector2f newVelocity{};
+      float radius = 0.f;
+      float maxSpeed = 0.f;
+    };
+
+    std::vector<Agent> m_agents;
+
+    float m_cellSize = 1.f;
+    std::uint32_t m_bucketMask = 0;
+    std::vector<std::uint32_t> m_bucketStart;
+    std::vector<std::uint32_t> m_bucketAgents;
+
+    [[nodiscard]] sf::Vector2i cellOf(sf::Vector2f p) const;
+    [[nodiscard]] std::uint32_t bucketOf(sf::Vector2i cell) const;
+  };
+}
+
+#endif //NULLP0INT_PATHFINDINGCROWD_H
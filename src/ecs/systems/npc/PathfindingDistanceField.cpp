@@ -4,63 +4,234 @@
 
 #include "PathfindingDistanceField.h"
 
-#include <queue>
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
 
 namespace ecs::npc
 {
   void DistanceFieldCache::rebuildIfNeeded(const TilemapComponent &map, const Grid &g, const sf::Vector2i playerTile)
   {
-    const bool needRebuild =
-      !m_valid ||
-      m_map != &map ||
-      m_w != g.w ||
-      m_h != g.h ||
-      m_playerTile != playerTile;
+    const bool sameMap =
+      m_valid &&
+      m_map == &map &&
+      m_mapRevision == map.revision &&
+      m_w == g.w &&
+      m_h == g.h;
 
-    if (!needRebuild) return;
+    if (sameMap && m_playerTile == playerTile) return;
+
+    const sf::Vector2i previousTile = m_playerTile;
+    const bool oneTileMove =
+      sameMap &&
+      std::abs(playerTile.x - previousTile.x) <= 1 &&
+      std::abs(playerTile.y - previousTile.y) <= 1;
 
     m_map = &map;
+    m_mapRevision = map.revision;
     m_w = g.w;
     m_h = g.h;
     m_playerTile = playerTile;
-    m_dist.assign(static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h), -1);
     m_valid = true;
 
-    if (g.blocked(playerTile.x, playerTile.y)) return;
+    if (oneTileMove && moveSource(g, previousTile, playerTile)) return;
+
+    rebuild(g, playerTile);
+  }
 
-    static const sf::Vector2i kDirs8[8] = {
-      { 1,  0}, {-1,  0}, { 0,  1}, { 0, -1},
-      { 1,  1}, { 1, -1}, {-1,  1}, {-1, -1}
-    };
+  void DistanceFieldCache::rebuild(const Grid& g, const sf::Vector2i playerTile)
+  {
+    m_dist.assign(static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h), -1);
+    m_toward.assign(m_dist.size(), NO_STEP);
+    m_away.assign(m_dist.size(), NO_STEP);
+    m_stamp.assign(m_dist.size(), 0);
+    m_stampValue = 0;
+
+    if (g.blocked(playerTile.x, playerTile.y)) return;
 
-    std::queue<sf::Vector2i> q;
+    m_queue.clear();
     m_dist[g.idx(playerTile.x, playerTile.y)] = 0;
-    q.push(playerTile);
+    m_queue.push_back(g.idx(playerTile.x, playerTile.y));
+
+    for (std::size_t head = 0; head < m_queue.size(); ++head)
+    {
+      const int cur = m_queue[head];
+      const int curD = m_dist[cur];
+      forEachNeighbour(g, cur % g.w, cur / g.w, [&](const int n, int, int)
+      {
+        if (m_dist[n] != -1) return;
+        m_dist[n] = curD + 1;
+        m_queue.push_back(n);
+      });
+    }
+
+    for (const int index : m_queue)
+    {
+      refreshSteps(g, index);
+    }
+  }
+
+  bool DistanceFieldCache::moveSource(const Grid& g, const sf::Vector2i from, const sf::Vector2i to)
+  {
+    if (g.blocked(from.x, from.y) || g.blocked(to.x, to.y)) return false;
+
+    const int fromIndex = g.idx(from.x, from.y);
+    const int toIndex = g.idx(to.x, to.y);
+    if (m_dist[fromIndex] != 0 || m_dist[toIndex] <= 0) return false;
+
+    m_dist[toIndex] = 0;
+    m_queue.clear();
+    m_queue.push_back(toIndex);
 
-    while (!q.empty())
+    for (std::size_t head = 0; head < m_queue.size(); ++head)
     {
-      const sf::Vector2i cur = q.front();
-      q.pop();
+      const int cur = m_queue[head];
+      const int nextD = m_dist[cur] + 1;
+      forEachNeighbour(g, cur % g.w, cur / g.w, [&](const int n, int, int)
+      {
+        if (m_dist[n] != -1 && m_dist[n] <= nextD) return;
+        m_dist[n] = nextD;
+        m_queue.push_back(n);
+      });
+    }
 
-      const int curD = m_dist[g.idx(cur.x, cur.y)];
-      for (const auto d : kDirs8)
+    nextStamp();
+    m_affected.clear();
+    m_affected.push_back(fromIndex);
+    m_stamp[fromIndex] = m_stampValue;
+
+    for (std::size_t head = 0; head < m_affected.size(); ++head)
+    {
+      const int cur = m_affected[head];
+      const int curD = m_dist[cur];
+      forEachNeighbour(g, cur % g.w, cur / g.w, [&](const int n, const int nx, const int ny)
       {
-        const int nx = cur.x + d.x;
-        const int ny = cur.y + d.y;
-        if (!g.inBounds(nx, ny)) continue;
-        if (g.blocked(nx, ny)) continue;
+        if (m_dist[n] != curD + 1 || m_stamp[n] == m_stampValue) return;
 
-        if (d.x != 0 && d.y != 0)
+        bool supported = false;
+        forEachNeighbour(g, nx, ny, [&](const int p, int, int)
         {
-          if (g.blocked(cur.x + d.x, cur.y) || g.blocked(cur.x, cur.y + d.y)) continue;
-        }
+          if (m_dist[p] == curD && m_stamp[p] != m_stampValue) supported = true;
+        });
+        if (supported) return;
+
+        m_stamp[n] = m_stampValue;
+        m_affected.push_back(n);
+      });
+    }
 
-        const int nIndex = g.idx(nx, ny);
-        if (m_dist[nIndex] != -1) continue;
+    for (const int a : m_affected)
+    {
+      m_dist[a] = -1;
+    }
+
+    m_heap.clear();
+    for (const int a : m_affected)
+    {
+      int best = -1;
+      forEachNeighbour(g, a % g.w, a / g.w, [&](const int n, int, int)
+      {
+        if (m_stamp[n] == m_stampValue || m_dist[n] < 0) return;
+        if (best == -1 || m_dist[n] + 1 < best) best = m_dist[n] + 1;
+      });
+      if (best == -1) continue;
+
+      m_dist[a] = best;
+      m_heap.emplace_back(best, a);
+    }
+    std::ranges::make_heap(m_heap, std::greater{});
+
+    while (!m_heap.empty())
+    {
+      std::ranges::pop_heap(m_heap, std::greater{});
+      const auto [d, cur] = m_heap.back();
+      m_heap.pop_back();
+      if (m_dist[cur] != d) continue;
 
-        m_dist[nIndex] = curD + 1;
-        q.emplace(nx, ny);
+      forEachNeighbour(g, cur % g.w, cur / g.w, [&](const int n, int, int)
+      {
+        if (m_stamp[n] != m_stampValue) return;
+        if (m_dist[n] != -1 && m_dist[n] <= d + 1) return;
+
+        m_dist[n] = d + 1;
+        m_heap.emplace_back(d + 1, n);
+        std::ranges::push_heap(m_heap, std::greater{});
+      });
+    }
+
+    for (const int index : m_queue)
+    {
+      refreshStepsAround(g, index);
+    }
+    for (const int index : m_affected)
+    {
+      refreshStepsAround(g, index);
+    }
+
+    return true;
+  }
+
+  void DistanceFieldCache::refreshSteps(const Grid& g, const int index)
+  {
+    const auto i = static_cast<std::size_t>(index);
+    m_toward[i] = NO_STEP;
+    m_away[i] = NO_STEP;
+
+    const int curDist = m_dist[i];
+    if (curDist < 0) return;
+
+    const int x = index % g.w;
+    const int y = index / g.w;
+    int bestToward = curDist;
+    int bestAway = curDist;
+
+    for (std::uint8_t dir = 0; dir < 8; ++dir)
+    {
+      const sf::Vector2i d = kDirs8[dir];
+      const int nx = x + d.x;
+      const int ny = y + d.y;
+      if (!g.inBounds(nx, ny)) continue;
+      if (g.blocked(nx, ny)) continue;
+
+      if (d.x != 0 && d.y != 0)
+      {
+        if (g.blocked(x + d.x, y) || g.blocked(x, y + d.y)) continue;
       }
+
+      const int nd = m_dist[g.idx(nx, ny)];
+      if (nd < 0) continue;
+
+      if (nd < bestToward)
+      {
+        bestToward = nd;
+        m_toward[i] = dir;
+      }
+      if (nd > bestAway)
+      {
+        bestAway = nd;
+        m_away[i] = dir;
+      }
+    }
+  }
+
+  void DistanceFieldCache::refreshStepsAround(const Grid& g, const int index)
+  {
+    refreshSteps(g, index);
+
+    const int x = index % g.w;
+    const int y = index / g.w;
+    for (const auto d : kDirs8)
+    {
+      if (g.inBounds(x + d.x, y + d.y)) refreshSteps(g, g.idx(x + d.x, y + d.y));
+    }
+  }
+
+  void DistanceFieldCache::nextStamp()
+  {
+    if (++m_stampValue == 0)
+    {
+      std::ranges::fill(m_stamp, 0u);
+      m_stampValue = 1;
     }
   }
 
@@ -70,4 +241,4 @@ namespace ecs::npc
     if (!g.inBounds(tile.x, tile.y)) return -1;
     return m_dist[g.idx(tile.x, tile.y)];
   }
-}
\ No newline at end of file
+}
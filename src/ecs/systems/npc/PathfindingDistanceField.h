@@ -4,6 +4,11 @@
 
 #ifndef NULLP0INT_PATHFINDINGDISTANCEFIELD_H
 #define NULLP0INT_PATHFINDINGDISTANCEFIELD_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
 #include "PathfindingTypes.h"
 
 namespace ecs::npc
@@ -11,20 +16,40 @@ namespace ecs::npc
   class DistanceFieldCache
   {
   public:
+    static constexpr std::uint8_t NO_STEP = 0xFF;
+
     void rebuildIfNeeded(const TilemapComponent& map, const Grid& g, sf::Vector2i playerTile);
 
     [[nodiscard]] int getDist(const Grid& g, sf::Vector2i tile) const;
 
-    [[nodiscard]] const std::vector<int>& field() { return m_dist; }
+    [[nodiscard]] const std::vector<int>& field() const { return m_dist; }
+
+    [[nodiscard]] std::uint8_t towardStep(const int index) const { return m_toward[static_cast<std::size_t>(index)]; }
+    [[nodiscard]] std::uint8_t awayStep(const int index) const { return m_away[static_cast<std::size_t>(index)]; }
 
   private:
     const TilemapComponent* m_map = nullptr;
+    std::uint32_t m_mapRevision = 0;
     int m_w = 0;
     int m_h = 0;
     sf::Vector2i m_playerTile{ -999, -999 };
     std::vector<int> m_dist;
+    std::vector<std::uint8_t> m_toward;
+    std::vector<std::uint8_t> m_away;
     bool m_valid = false;
+
+    std::vector<int> m_queue;
+    std::vector<int> m_affected;
+    std::vector<std::uint32_t> m_stamp;
+    std::uint32_t m_stampValue = 0;
+    std::vector<std::pair<int, int>> m_heap;
+
+    void rebuild(const Grid& g, sf::Vector2i playerTile);
+    [[nodiscard]] bool moveSource(const Grid& g, sf::Vector2i from, sf::Vector2i to);
+    void nextStamp();
+    void refreshSteps(const Grid& g, int index);
+    void refreshStepsAround(const Grid& g, int index);
   };
 }
 
-#endif //NULLP0INT_PATHFINDINGDISTANCEFIELD_H
\ No newline at end of file
+#endif //NULLP0INT_PATHFINDINGDISTANCEFIELD_H
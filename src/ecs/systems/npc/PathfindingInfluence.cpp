@@ -0,0 +1,141 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "PathfindingInfluence.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ecs::npc
+{
+  void InfluenceMap::begin(const Grid& g, const sf::Vector2i center, const int radiusTiles)
+  {
+    m_center = center;
+
+    const int r = std::max(0, radiusTiles);
+    m_x0 = std::max(0, center.x - r);
+    m_y0 = std::max(0, center.y - r);
+    m_w = std::max(0, std::min(g.w, center.x + r + 1) - m_x0);
+    m_h = std::max(0, std::min(g.h, center.y + r + 1) - m_y0);
+
+    const std::size_t cells = static_cast<std::size_t>(m_w) * static_cast<std::size_t>(m_h);
+    m_fire.assign(cells, 0.f);
+    m_threat.assign(cells, 0.f);
+    m_crowd.assign(cells, 0.f);
+    m_scratch.assign(cells, 0.f);
+  }
+
+  void InfluenceMap::addEnemy(const sf::Vector2i tile)
+  {
+    if (covers(tile)) m_crowd[local(tile)] += 1.f;
+  }
+
+  void InfluenceMap::finish(const TilemapComponent& map, const Grid& g, const VisibilityField& visibility,
+                            const sf::Vector2f playerFacing)
+  {
+    if (m_map != &map || m_mapRevision != map.revision || m_gridW != g.w || m_gridH != g.h)
+    {
+      m_map = &map;
+      m_mapRevision = map.revision;
+      m_gridW = g.w;
+      m_gridH = g.h;
+      rebuildCover(g);
+    }
+
+    for (int ly = 0; ly < m_h; ++ly)
+    {
+      const int y = m_y0 + ly;
+      float* fire = m_fire.data() + static_cast<std::size_t>(ly) * static_cast<std::size_t>(m_w);
+      float* threat = m_threat.data() + static_cast<std::size_t>(ly) * static_cast<std::size_t>(m_w);
+
+      for (int lx = 0; lx < m_w; ++lx)
+      {
+        fire[lx] = visibility.visible(g, {m_x0 + lx, y}) ? 1.f : 0.f;
+      }
+
+      const auto dy = static_cast<float>(y - m_center.y);
+      for (int lx = 0; lx < m_w; ++lx)
+      {
+        const auto dx = static_cast<float>(m_x0 + lx - m_center.x);
+        const float len = std::sqrt(dx * dx + dy * dy);
+        const float facing = len > 0.f ? (dx * playerFacing.x + dy * playerFacing.y) / len : 1.f;
+        const float aimed = (facing + 1.f) * 0.5f;
+        threat[lx] = fire[lx] * aimed * aimed;
+      }
+    }
+
+    blurCrowd();
+  }
+
+  float InfluenceMap::tacticalCost(const sf::Vector2i tile, const TacticalTuning& tuning) const
+  {
+    if (!covers(tile)) return 0.f;
+
+    const std::size_t i = local(tile);
+    return m_threat[i] * tuning.threatWeight
+         + m_crowd[i] * tuning.crowdWeight
+         - m_fire[i] * tuning.fireWeight
+         - m_cover[static_cast<std::size_t>(tile.x + tile.y * m_gridW)] * tuning.coverWeight;
+  }
+
+  void InfluenceMap::rebuildCover(const Grid& g)
+  {
+    m_cover.assign(static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h), 0.f);
+
+    for (int y = 0; y < g.h; ++y)
+    {
+      for (int x = 0; x < g.w; ++x)
+      {
+        if (g.blocked(x, y)) continue;
+
+        int walls = 0;
+        for (const auto d : kDirs8)
+        {
+          if (!g.inBounds(x + d.x, y + d.y) || g.blocked(x + d.x, y + d.y)) ++walls;
+        }
+        m_cover[static_cast<std::size_t>(g.idx(x, y))] = static_cast<float>(walls) * (1.f / 8.f);
+      }
+    }
+  }
+
+  void InfluenceMap::blurCrowd()
+  {
+    if (m_w == 0 || m_h == 0) return;
+
+    const auto w = static_cast<std::size_t>(m_w);
+    const auto h = static_cast<std::size_t>(m_h);
+
+    for (std::size_t y = 0; y < h; ++y)
+    {
+      const float* src = m_crowd.data() + y * w;
+      float* dst = m_scratch.data() + y * w;
+
+      dst[0] = src[0] + (w > 1 ? src[1] : 0.f);
+      for (std::size_t x = 1; x + 1 < w; ++x) dst[x] = src[x - 1] + src[x] + src[x + 1];
+      if (w > 1) dst[w - 1] = src[w - 2] + src[w - 1];
+    }
+
+    for (std::size_t y = 0; y < h; ++y)
+    {
+      const float* above = y > 0 ? m_scratch.data() + (y - 1) * w : nullptr;
+      const float* row = m_scratch.data() + y * w;
+      const float* below = y + 1 < h ? m_scratch.data() + (y + 1) * w : nullptr;
+      float* dst = m_crowd.data() + y * w;
+
+      for (std::size_t x = 0; x < w; ++x) dst[x] = row[x];
+
+      if (above)
+      {
+        for (std::size_t x = 0; x < w; ++x) dst[x] += above[x];
+      }
+
+      if (below)
+      {
+        for (std::size_t x = 0; x < w; ++x) dst[x] += below[x];
+      }
+
+      for (std::size_t x = 0; x < w; ++x) dst[x] *= 1.f / 9.f;
+    }
+  }
+}
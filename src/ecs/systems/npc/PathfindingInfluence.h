@@ -0,0 +1,70 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_PATHFINDINGINFLUENCE_H
+#define NULLP0INT_PATHFINDINGINFLUENCE_H
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "PathfindingTypes.h"
+#include "PathfindingVisibility.h"
+
+namespace ecs::npc
+{
+  struct TacticalTuning
+  {
+    float fireWeight = 0.6f;
+    float threatWeight = 0.5f;
+    float crowdWeight = 0.4f;
+    float coverWeight = 0.3f;
+  };
+
+  inline constexpr TacticalTuning DEFAULT_TACTICAL_TUNING{};
+
+  class InfluenceMap
+  {
+  public:
+    void begin(const Grid& g, sf::Vector2i center, int radiusTiles);
+    void addEnemy(sf::Vector2i tile);
+    void finish(const TilemapComponent& map, const Grid& g, const VisibilityField& visibility, sf::Vector2f playerFacing);
+
+    [[nodiscard]] bool covers(const sf::Vector2i tile) const
+    {
+      return tile.x >= m_x0 && tile.y >= m_y0 && tile.x < m_x0 + m_w && tile.y < m_y0 + m_h;
+    }
+
+    [[nodiscard]] float tacticalCost(sf::Vector2i tile, const TacticalTuning& tuning = DEFAULT_TACTICAL_TUNING) const;
+
+  private:
+    const TilemapComponent* m_map = nullptr;
+    std::uint32_t m_mapRevision = 0;
+    int m_gridW = 0;
+    int m_gridH = 0;
+    std::vector<float> m_cover;
+
+    sf::Vector2i m_center{};
+    int m_x0 = 0;
+    int m_y0 = 0;
+    int m_w = 0;
+    int m_h = 0;
+
+    std::vector<float> m_fire;
+    std::vector<float> m_threat;
+    std::vector<float> m_crowd;
+    std::vector<float> m_scratch;
+
+    [[nodiscard]] std::size_t local(const sf::Vector2i tile) const
+    {
+      return static_cast<std::size_t>(tile.x - m_x0) + static_cast<std::size_t>(tile.y - m_y0) * static_cast<std::size_t>(m_w);
+    }
+
+    void rebuildCover(const Grid& g);
+    void blurCrowd();
+  };
+}
+
+#endif //NULLP0INT_PATHFINDINGINFLUENCE_H
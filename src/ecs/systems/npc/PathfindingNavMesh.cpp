@@ -0,0 +1,405 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "PathfindingNavMesh.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace
+{
+  [[nodiscard]] float distance(const sf::Vector2f a, const sf::Vector2f b)
+  {
+    return std::hypot(b.x - a.x, b.y - a.y);
+  }
+
+  [[nodiscard]] bool circleClear(const ecs::npc::Grid& g, const sf::Vector2f c, const float radius)
+  {
+    const int minX = static_cast<int>(std::floor((c.x - radius) / g.tileSize));
+    const int maxX = static_cast<int>(std::floor((c.x + radius) / g.tileSize));
+    const int minY = static_cast<int>(std::floor((c.y - radius) / g.tileSize));
+    const int maxY = static_cast<int>(std::floor((c.y + radius) / g.tileSize));
+
+    for (int ty = minY; ty <= maxY; ++ty)
+    {
+      for (int tx = minX; tx <= maxX; ++tx)
+      {
+        if (g.inBounds(tx, ty) && !g.blocked(tx, ty)) continue;
+
+        const float left = static_cast<float>(tx) * g.tileSize;
+        const float top = static_cast<float>(ty) * g.tileSize;
+        const float dx = c.x - std::clamp(c.x, left, left + g.tileSize);
+        const float dy = c.y - std::clamp(c.y, top, top + g.tileSize);
+        if (dx * dx + dy * dy < radius * radius) return false;
+      }
+    }
+
+    return true;
+  }
+
+  [[nodiscard]] bool segmentClear(const ecs::npc::Grid& g, const sf::Vector2f a, const sf::Vector2f b, const float radius)
+  {
+    const float step = std::max(radius, g.tileSize * 0.0625f);
+    const int samples = static_cast<int>(distance(a, b) / step) + 1;
+    for (int i = 0; i <= samples; ++i)
+    {
+      if (!circleClear(g, a + (b - a) * (static_cast<float>(i) / static_cast<float>(samples)), radius)) return false;
+    }
+    return true;
+  }
+
+  [[nodiscard]] float triarea2(const sf::Vector2f a, const sf::Vector2f b, const sf::Vector2f c)
+  {
+    const sf::Vector2f ab = b - a;
+    const sf::Vector2f ac = c - a;
+    return ac.x * ab.y - ab.x * ac.y;
+  }
+}
+
+namespace ecs::npc
+{
+  void NavMesh::rebuildIfNeeded(const TilemapComponent& map, const Grid& g)
+  {
+    if (m_map == &map && m_mapRevision == map.revision && m_w == g.w && m_h == g.h) return;
+
+    m_map = &map;
+    m_mapRevision = map.revision;
+    m_w = g.w;
+    m_h = g.h;
+    build(g);
+  }
+
+  int NavMesh::rectAt(const Grid& g, const sf::Vector2i tile) const
+  {
+    if (!g.inBounds(tile.x, tile.y) || m_rectOfTile.empty()) return -1;
+    return m_rectOfTile[static_cast<std::size_t>(g.idx(tile.x, tile.y))];
+  }
+
+  bool NavMesh::findPath(const Grid& g, const sf::Vector2f from, const sf::Vector2f to, const float clearance,
+                         std::vector<sf::Vector2f>& waypoints) const
+  {
+    waypoints.clear();
+    if (m_rects.empty() || !(g.tileSize > 0.f)) return false;
+
+    const auto tileOf = [&](const sf::Vector2f p)
+    {
+      return sf::Vector2i{
+        static_cast<int>(std::floor(p.x / g.tileSize)),
+        static_cast<int>(std::floor(p.y / g.tileSize))
+      };
+    };
+
+    const int startRect = rectAt(g, tileOf(from));
+    const int goalRect = rectAt(g, tileOf(to));
+    if (startRect < 0 || goalRect < 0) return false;
+
+    if (startRect == goalRect)
+    {
+      waypoints.push_back(to);
+      return true;
+    }
+
+    thread_local Search search;
+    if (search.generation != m_generation)
+    {
+      search.generation = m_generation;
+      search.cost.assign(m_rects.size(), 0.f);
+      search.viaPortal.assign(m_rects.size(), -1);
+      search.entry.assign(m_rects.size(), {});
+      search.stamp.assign(m_rects.size(), 0);
+      search.stampValue = 0;
+    }
+
+    if (!searchCorridor(search, startRect, goalRect, from, to, g.tileSize)) return false;
+
+    pullString(search, startRect, from, to, clearance, g.tileSize, waypoints);
+    clearCorners(g, from, clearance, waypoints);
+    return true;
+  }
+
+  void NavMesh::build(const Grid& g)
+  {
+    m_rects.clear();
+    m_portals.clear();
+    m_rectOfTile.assign(static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h), -1);
+
+    const auto freeTile = [&](const int x, const int y)
+    {
+      return !g.blocked(x, y) && m_rectOfTile[static_cast<std::size_t>(g.idx(x, y))] == -1;
+    };
+
+    for (int y = 0; y < g.h; ++y)
+    {
+      for (int x = 0; x < g.w; ++x)
+      {
+        if (!freeTile(x, y)) continue;
+
+        Rect r;
+        r.x0 = x;
+        r.y0 = y;
+        r.x1 = x + 1;
+        while (r.x1 < g.w && freeTile(r.x1, y)) ++r.x1;
+
+        r.y1 = y + 1;
+        while (r.y1 < g.h)
+        {
+          bool rowFree = true;
+          for (int rx = r.x0; rx < r.x1 && rowFree; ++rx) rowFree = freeTile(rx, r.y1);
+          if (!rowFree) break;
+          ++r.y1;
+        }
+
+        const int id = static_cast<int>(m_rects.size());
+        for (int ry = r.y0; ry < r.y1; ++ry)
+        {
+          std::fill_n(m_rectOfTile.begin() + g.idx(r.x0, ry), r.x1 - r.x0, id);
+        }
+        m_rects.push_back(std::move(r));
+      }
+    }
+
+    for (int id = 0; id < static_cast<int>(m_rects.size()); ++id)
+    {
+      const Rect& r = m_rects[static_cast<std::size_t>(id)];
+      if (r.x1 < g.w) addPortals(id, {r.x1, r.y0}, {0, 1}, r.y1 - r.y0);
+      if (r.y1 < g.h) addPortals(id, {r.x0, r.y1}, {1, 0}, r.x1 - r.x0);
+    }
+
+    static std::uint32_t nextGeneration = 0;
+    m_generation = ++nextGeneration;
+  }
+
+  void NavMesh::addPortals(const int rect, const sf::Vector2i first, const sf::Vector2i along, const int length)
+  {
+    const auto neighbourAt = [&](const int i)
+    {
+      const sf::Vector2i t = first + along * i;
+      return m_rectOfTile[static_cast<std::size_t>(t.x + t.y * m_w)];
+    };
+
+    int i = 0;
+    while (i < length)
+    {
+      const int other = neighbourAt(i);
+      const int runStart = i;
+      while (i < length && neighbourAt(i) == other) ++i;
+      if (other < 0) continue;
+
+      Portal p;
+      p.a = rect;
+      p.b = other;
+      p.p0 = sf::Vector2f(first + along * runStart);
+      p.p1 = sf::Vector2f(first + along * i);
+
+      const int id = static_cast<int>(m_portals.size());
+      m_portals.push_back(p);
+      m_rects[static_cast<std::size_t>(rect)].portals.push_back(id);
+      m_rects[static_cast<std::size_t>(other)].portals.push_back(id);
+    }
+  }
+
+  bool NavMesh::searchCorridor(Search& search, const int startRect, const int goalRect, const sf::Vector2f from,
+                               const sf::Vector2f to, const float tileSize) const
+  {
+    if (++search.stampValue == 0)
+    {
+      std::ranges::fill(search.stamp, 0u);
+      search.stampValue = 1;
+    }
+
+    const auto visit = [&](const int r)
+    {
+      const auto i = static_cast<std::size_t>(r);
+      if (search.stamp[i] == search.stampValue) return;
+      search.stamp[i] = search.stampValue;
+      search.cost[i] = std::numeric_limits<float>::infinity();
+      search.viaPortal[i] = -1;
+    };
+
+    visit(startRect);
+    search.cost[static_cast<std::size_t>(startRect)] = 0.f;
+    search.entry[static_cast<std::size_t>(startRect)] = from;
+
+    search.open.clear();
+    search.open.emplace_back(distance(from, to), startRect);
+
+    bool found = false;
+    while (!search.open.empty())
+    {
+      std::ranges::pop_heap(search.open, std::greater{});
+      const auto [f, cur] = search.open.back();
+      search.open.pop_back();
+
+      const auto ci = static_cast<std::size_t>(cur);
+      if (f > search.cost[ci] + distance(search.entry[ci], to)) continue;
+      if (cur == goalRect)
+      {
+        found = true;
+        break;
+      }
+
+      for (const int portalId : m_rects[ci].portals)
+      {
+        const Portal& p = m_portals[static_cast<std::size_t>(portalId)];
+        const int next = p.a == cur ? p.b : p.a;
+        const sf::Vector2f mid = (p.p0 + p.p1) * (0.5f * tileSize);
+        const float cost = search.cost[ci] + distance(search.entry[ci], mid);
+
+        visit(next);
+        const auto ni = static_cast<std::size_t>(next);
+        if (cost >= search.cost[ni]) continue;
+
+        search.cost[ni] = cost;
+        search.viaPortal[ni] = portalId;
+        search.entry[ni] = mid;
+        search.open.emplace_back(cost + distance(mid, to), next);
+        std::ranges::push_heap(search.open, std::greater{});
+      }
+    }
+
+    if (!found) return false;
+
+    search.corridor.clear();
+    for (int r = goalRect; r != startRect;)
+    {
+      const int portalId = search.viaPortal[static_cast<std::size_t>(r)];
+      search.corridor.push_back(portalId);
+      const Portal& p = m_portals[static_cast<std::size_t>(portalId)];
+      r = p.a == r ? p.b : p.a;
+    }
+    std::ranges::reverse(search.corridor);
+    return true;
+  }
+
+  void NavMesh::pullString(Search& search, const int startRect, const sf::Vector2f from, const sf::Vector2f to,
+                           const float clearance, const float tileSize, std::vector<sf::Vector2f>& waypoints) const
+  {
+    search.funnel.clear();
+    search.funnel.emplace_back(from, from);
+
+    int rect = startRect;
+    for (const int portalId : search.corridor)
+    {
+      const Portal& p = m_portals[static_cast<std::size_t>(portalId)];
+      const float forward = p.a == rect ? 1.f : -1.f;
+      const sf::Vector2f travel = p.p0.x == p.p1.x ? sf::Vector2f{forward, 0.f} : sf::Vector2f{0.f, forward};
+      rect = p.a == rect ? p.b : p.a;
+
+      sf::Vector2f a = p.p0 * tileSize;
+      sf::Vector2f b = p.p1 * tileSize;
+
+      if (const float len = distance(a, b); len > 2.f * clearance)
+      {
+        const sf::Vector2f dir = (b - a) / len;
+        a += dir * clearance;
+        b -= dir * clearance;
+      }
+      else
+      {
+        a = b = (a + b) * 0.5f;
+      }
+
+      const sf::Vector2f edge = p.p1 - p.p0;
+      if (travel.x * edge.y - travel.y * edge.x < 0.f) search.funnel.emplace_back(a, b);
+      else search.funnel.emplace_back(b, a);
+    }
+    search.funnel.emplace_back(to, to);
+
+    sf::Vector2f apex = from;
+    sf::Vector2f left = from;
+    sf::Vector2f right = from;
+    std::size_t apexIndex = 0;
+    std::size_t leftIndex = 0;
+    std::size_t rightIndex = 0;
+
+    for (std::size_t i = 1; i < search.funnel.size(); ++i)
+    {
+      const auto [l, r] = search.funnel[i];
+
+      if (triarea2(apex, right, r) <= 0.f)
+      {
+        if (apex == right || triarea2(apex, left, r) > 0.f)
+        {
+          right = r;
+          rightIndex = i;
+        }
+        else
+        {
+          waypoints.push_back(left);
+          apex = left;
+          apexIndex = leftIndex;
+          left = right = apex;
+          leftIndex = rightIndex = apexIndex;
+          i = apexIndex;
+          continue;
+        }
+      }
+
+      if (triarea2(apex, left, l) >= 0.f)
+      {
+        if (apex == left || triarea2(apex, right, l) < 0.f)
+        {
+          left = l;
+          leftIndex = i;
+        }
+        else
+        {
+          waypoints.push_back(right);
+          apex = right;
+          apexIndex = rightIndex;
+          left = right = apex;
+          leftIndex = rightIndex = apexIndex;
+          i = apexIndex;
+          continue;
+        }
+      }
+    }
+
+    if (waypoints.empty() || waypoints.back() != to) waypoints.push_back(to);
+  }
+
+  void NavMesh::clearCorners(const Grid& g, const sf::Vector2f from, const float clearance,
+                             std::vector<sf::Vector2f>& waypoints) const
+  {
+    sf::Vector2f previous = from;
+    for (std::size_t i = 0; i + 1 < waypoints.size(); ++i)
+    {
+      const sf::Vector2f corner = waypoints[i];
+      const sf::Vector2f pivot{
+        std::round(corner.x / g.tileSize) * g.tileSize,
+        std::round(corner.y / g.tileSize) * g.tileSize
+      };
+      if (distance(corner, pivot) > clearance * 1.01f)
+      {
+        previous = corner;
+        continue;
+      }
+
+      const sf::Vector2f in = normalizedOrZero(corner - previous);
+      const sf::Vector2f out = normalizedOrZero(waypoints[i + 1] - corner);
+      const sf::Vector2f away = corner - pivot;
+
+      sf::Vector2f n1{-in.y, in.x};
+      if (n1.x * away.x + n1.y * away.y < 0.f) n1 = -n1;
+      sf::Vector2f n2{-out.y, out.x};
+      if (n2.x * away.x + n2.y * away.y < 0.f) n2 = -n2;
+
+      const sf::Vector2f bisector = normalizedOrZero(n1 + n2);
+      const float cosHalf = bisector.x * n1.x + bisector.y * n1.y;
+      const float reach = clearance / std::max(cosHalf, 0.5f);
+      const sf::Vector2f offset = pivot + bisector * reach;
+
+      if (bisector != sf::Vector2f{0.f, 0.f} &&
+          circleClear(g, offset, clearance) &&
+          segmentClear(g, previous, offset, clearance * 0.5f) &&
+          segmentClear(g, offset, waypoints[i + 1], g.tileSize * 0.01f))
+      {
+        waypoints[i] = offset;
+      }
+      previous = waypoints[i];
+    }
+  }
+}
@@ -0,0 +1,81 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_PATHFINDINGNAVMESH_H
+#define NULLP0INT_PATHFINDINGNAVMESH_H
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "PathfindingTypes.h"
+
+namespace ecs::npc
+{
+  class NavMesh
+  {
+  public:
+    void rebuildIfNeeded(const TilemapComponent& map, const Grid& g);
+
+    [[nodiscard]] bool findPath(const Grid& g, sf::Vector2f from, sf::Vector2f to, float clearance,
+                                std::vector<sf::Vector2f>& waypoints) const;
+
+    [[nodiscard]] int rectAt(const Grid& g, sf::Vector2i tile) const;
+    [[nodiscard]] std::size_t rectCount() const { return m_rects.size(); }
+
+  private:
+    struct Rect
+    {
+      int x0 = 0;
+      int y0 = 0;
+      int x1 = 0;
+      int y1 = 0;
+      std::vector<int> portals;
+    };
+
+    struct Portal
+    {
+      int a = -1;
+      int b = -1;
+      sf::Vector2f p0{};
+      sf::Vector2f p1{};
+    };
+
+    struct Search
+    {
+      std::uint32_t generation = 0;
+      std::vector<float> cost;
+      std::vector<int> viaPortal;
+      std::vector<sf::Vector2f> entry;
+      std::vector<std::uint32_t> stamp;
+      std::uint32_t stampValue = 0;
+      std::vector<std::pair<float, int>> open;
+
+      std::vector<int> corridor;
+      std::vector<std::pair<sf::Vector2f, sf::Vector2f>> funnel;
+    };
+
+    const TilemapComponent* m_map = nullptr;
+    std::uint32_t m_mapRevision = 0;
+    std::uint32_t m_generation = 0;
+    int m_w = 0;
+    int m_h = 0;
+
+    std::vector<Rect> m_rects;
+    std::vector<Portal> m_portals;
+    std::vector<int> m_rectOfTile;
+
+    void build(const Grid& g);
+    void addPortals(int rect, sf::Vector2i first, sf::Vector2i along, int length);
+    [[nodiscard]] bool searchCorridor(Search& search, int startRect, int goalRect, sf::Vector2f from, sf::Vector2f to,
+                                      float tileSize) const;
+    void pullString(Search& search, int startRect, sf::Vector2f from, sf::Vector2f to, float clearance, float tileSize,
+                    std::vector<sf::Vector2f>& waypoints) const;
+    void clearCorners(const Grid& g, sf::Vector2f from, float clearance, std::vector<sf::Vector2f>& waypoints) const;
+  };
+}
+
+#endif //NULLP0INT_PATHFINDINGNAVMESH_H
@@ -0,0 +1,44 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "PathfindingOccupancy.h"
+
+#include <algorithm>
+
+namespace ecs::npc
+{
+  void OccupancyGrid::reset(const Grid& g)
+  {
+    const std::size_t cells = static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h);
+    if (m_occupied.size() != cells)
+    {
+      m_occupied.assign(cells, 0);
+      m_claims.assign(cells, {});
+      m_generation = 0;
+    }
+
+    if (++m_generation == 0)
+    {
+      std::ranges::fill(m_occupied, 0u);
+      std::ranges::fill(m_claims, Claim{});
+      m_generation = 1;
+    }
+  }
+
+  void OccupancyGrid::claim(const int tile, const std::uint32_t reservation, const EntityIndex priority)
+  {
+    Claim& c = m_claims[static_cast<std::size_t>(tile)];
+    if (c.generation == m_generation && c.priority <= priority) return;
+
+    c.generation = m_generation;
+    c.reservation = reservation;
+    c.priority = priority;
+  }
+
+  bool OccupancyGrid::claimedBy(const int tile, const std::uint32_t reservation) const
+  {
+    const Claim& c = m_claims[static_cast<std::size_t>(tile)];
+    return c.generation == m_generation && c.reservation == reservation;
+  }
+}
@@ -0,0 +1,48 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_PATHFINDINGOCCUPANCY_H
+#define NULLP0INT_PATHFINDINGOCCUPANCY_H
+
+#include <cstdint>
+#include <vector>
+
+#include "PathfindingTypes.h"
+#include "../../Entity.h"
+
+namespace ecs::npc
+{
+  class OccupancyGrid
+  {
+  public:
+    void reset(const Grid& g);
+
+    void markOccupied(const int tile)
+    {
+      m_occupied[static_cast<std::size_t>(tile)] = m_generation;
+    }
+
+    [[nodiscard]] bool contains(const int tile) const
+    {
+      return m_occupied[static_cast<std::size_t>(tile)] == m_generation;
+    }
+
+    void claim(int tile, std::uint32_t reservation, EntityIndex priority);
+    [[nodiscard]] bool claimedBy(int tile, std::uint32_t reservation) const;
+
+  private:
+    struct Claim
+    {
+      std::uint32_t generation = 0;
+      std::uint32_t reservation = 0;
+      EntityIndex priority = 0;
+    };
+
+    std::vector<std::uint32_t> m_occupied;
+    std::vector<Claim> m_claims;
+    std::uint32_t m_generation = 0;
+  };
+}
+
+#endif //NULLP0INT_PATHFINDINGOCCUPANCY_H
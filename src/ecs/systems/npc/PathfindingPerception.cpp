@@ -141,6 +141,7 @@ namespace ecs::npc
     const PositionComponent& enemyPos,
     const EnemyComponent& enemyComp,
     const TilemapComponent& map,
+    const VisibilityField& visibility,
     const PositionComponent& playerPos
   )
   {
@@ -154,7 +155,8 @@ namespace ecs::npc
     const float visionRangeWorld = enemyComp.visionRangeTiles * map.tileSize;
     r.withinVisionRange = std::isfinite(r.distWorld) && (r.distWorld <= visionRangeWorld);
 
-    r.los = hasLineOfSightWorld(map, enemyPos.position, playerPos.position);
+    r.los = visibility.covers(map.worldToTile(enemyPos.position))
+      && hasLineOfSightWorld(map, enemyPos.position, playerPos.position);
 
     if (r.withinVisionRange && r.los)
     {
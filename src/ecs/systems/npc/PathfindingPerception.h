@@ -9,6 +9,8 @@
 #include "../../Components.h"
 #include "../../Entity.h"
 #include "../../Registry.h"
+#include "PathfindingTypes.h"
+#include "PathfindingVisibility.h"
 
 namespace ecs::npc
 {
@@ -42,6 +44,7 @@ namespace ecs::npc
     const PositionComponent& enemyPos,
     const EnemyComponent& enemyComp,
     const TilemapComponent& map,
+    const VisibilityField& visibility,
     const PositionComponent& playerPos);
 }
 
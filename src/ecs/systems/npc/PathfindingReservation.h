@@ -4,9 +4,10 @@
 
 #ifndef NULLP0INT_PATHFINDINGRESERVATION_H
 #define NULLP0INT_PATHFINDINGRESERVATION_H
-#include <unordered_set>
+#include <vector>
 #include <SFML/System/Vector2.hpp>
 
+#include "PathfindingOccupancy.h"
 #include "PathfindingTypes.h"
 #include "../../Entity.h"
 
@@ -22,9 +23,9 @@ namespace ecs::npc
   };
 
   void resolveMoveReservations(
-    const Grid&                    g,
-    const std::unordered_set<int>& initiallyOccupied,
-    std::vector<MoveReservation>&  reservations
+    const Grid&                   g,
+    OccupancyGrid&                occupancy,
+    std::vector<MoveReservation>& reservations
   );
 }
 
@@ -16,6 +16,11 @@ namespace ecs::npc
 {
   inline constexpr float NORMALiZE_EPS = 1e-6f;
 
+  inline const sf::Vector2i kDirs8[8] = {
+    { 1,  0}, {-1,  0}, { 0,  1}, { 0, -1},
+    { 1,  1}, { 1, -1}, {-1,  1}, {-1, -1}
+  };
+
   struct Grid
   {
     int w = 0;
@@ -47,6 +52,25 @@ namespace ecs::npc
     }
   };
 
+  template <typename Fn>
+  void forEachNeighbour(const Grid& g, const int x, const int y, Fn&& fn)
+  {
+    for (const auto d : kDirs8)
+    {
+      const int nx = x + d.x;
+      const int ny = y + d.y;
+      if (!g.inBounds(nx, ny)) continue;
+      if (g.blocked(nx, ny)) continue;
+
+      if (d.x != 0 && d.y != 0)
+      {
+        if (g.blocked(x + d.x, y) || g.blocked(x, y + d.y)) continue;
+      }
+
+      fn(g.idx(nx, ny), nx, ny);
+    }
+  }
+
   [[nodiscard]] inline sf::Vector2f normalizedOrZero(const sf::Vector2f v, const float eps = NORMALiZE_EPS)
   {
     const float len = std::hypot(v.x, v.y);
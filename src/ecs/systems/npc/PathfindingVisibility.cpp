@@ -0,0 +1,98 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "PathfindingVisibility.h"
+
+namespace
+{
+  [[nodiscard]] int floorDiv(const int a, const int b)
+  {
+    const int q = a / b;
+    return (a % b != 0 && (a < 0) != (b < 0)) ? q - 1 : q;
+  }
+
+  [[nodiscard]] int ceilDiv(const int a, const int b)
+  {
+    return -floorDiv(-a, b);
+  }
+
+  [[nodiscard]] sf::Vector2i toWorldTile(const sf::Vector2i origin, const int quadrant, const int depth, const int col)
+  {
+    switch (quadrant)
+    {
+      case 0: return { origin.x + col, origin.y - depth };
+      case 1: return { origin.x + col, origin.y + depth };
+      case 2: return { origin.x + depth, origin.y + col };
+      default: return { origin.x - depth, origin.y + col };
+    }
+  }
+}
+
+namespace ecs::npc
+{
+  void VisibilityField::update(const TilemapComponent& map, const Grid& g, const sf::Vector2i origin, const int radiusTiles)
+  {
+    if (m_map == &map && m_mapRevision == map.revision && m_origin == origin && m_radius == radiusTiles) return;
+
+    m_map = &map;
+    m_mapRevision = map.revision;
+    m_origin = origin;
+    m_radius = radiusTiles;
+
+    const std::size_t cells = static_cast<std::size_t>(g.w) * static_cast<std::size_t>(g.h);
+    m_bits.assign((cells + 63) / 64, 0);
+
+    if (!g.inBounds(origin.x, origin.y) || radiusTiles < 0) return;
+
+    mark(g, origin.x, origin.y);
+    for (int quadrant = 0; quadrant < 4; ++quadrant) scanQuadrant(g, quadrant);
+  }
+
+  void VisibilityField::mark(const Grid& g, const int x, const int y)
+  {
+    if (!g.inBounds(x, y)) return;
+    const auto i = static_cast<std::size_t>(g.idx(x, y));
+    m_bits[i >> 6] |= std::uint64_t{1} << (i & 63);
+  }
+
+  void VisibilityField::scanQuadrant(const Grid& g, const int quadrant)
+  {
+    const auto isWall = [&](const sf::Vector2i t)
+    {
+      return !g.inBounds(t.x, t.y) || g.blocked(t.x, t.y);
+    };
+
+    m_rows.clear();
+    m_rows.push_back({1, {-1, 1}, {1, 1}});
+
+    while (!m_rows.empty())
+    {
+      Row row = m_rows.back();
+      m_rows.pop_back();
+      if (row.depth > m_radius) continue;
+
+      const int minCol = floorDiv(2 * row.depth * row.start.num + row.start.den, 2 * row.start.den);
+      const int maxCol = ceilDiv(2 * row.depth * row.end.num - row.end.den, 2 * row.end.den);
+
+      int prev = -1;
+      for (int col = minCol; col <= maxCol; ++col)
+      {
+        const sf::Vector2i t = toWorldTile(m_origin, quadrant, row.depth, col);
+        const bool wall = isWall(t);
+        const bool symmetric = col * row.start.den >= row.depth * row.start.num
+                            && col * row.end.den <= row.depth * row.end.num;
+
+        if (wall || symmetric) mark(g, t.x, t.y);
+
+        const Slope slope{ 2 * col - 1, 2 * row.depth };
+        if (prev == 1 && !wall) row.start = slope;
+        if (prev == 0 && wall) m_rows.push_back({row.depth + 1, row.start, slope});
+
+        prev = wall ? 1 : 0;
+      }
+
+      if (prev == 0) m_rows.push_back({row.depth + 1, row.start, row.end});
+    }
+  }
+}
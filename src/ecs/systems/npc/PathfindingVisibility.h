@@ -0,0 +1,63 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_PATHFINDINGVISIBILITY_H
+#define NULLP0INT_PATHFINDINGVISIBILITY_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "PathfindingTypes.h"
+
+namespace ecs::npc
+{
+  class VisibilityField
+  {
+  public:
+    void update(const TilemapComponent& map, const Grid& g, sf::Vector2i origin, int radiusTiles);
+
+    [[nodiscard]] bool covers(const sf::Vector2i tile) const
+    {
+      return std::max(std::abs(tile.x - m_origin.x), std::abs(tile.y - m_origin.y)) <= m_radius;
+    }
+
+    [[nodiscard]] bool visible(const Grid& g, const sf::Vector2i tile) const
+    {
+      if (!g.inBounds(tile.x, tile.y) || m_bits.empty()) return false;
+      const auto i = static_cast<std::size_t>(g.idx(tile.x, tile.y));
+      return (m_bits[i >> 6] >> (i & 63)) & 1u;
+    }
+
+  private:
+    struct Slope
+    {
+      int num = 0;
+      int den = 1;
+    };
+
+    struct Row
+    {
+      int depth = 1;
+      Slope start{};
+      Slope end{};
+    };
+
+    const TilemapComponent* m_map = nullptr;
+    std::uint32_t m_mapRevision = 0;
+    sf::Vector2i m_origin{ -999, -999 };
+    int m_radius = -1;
+
+    std::vector<std::uint64_t> m_bits;
+    std::vector<Row> m_rows;
+
+    void mark(const Grid& g, int x, int y);
+    void scanQuadrant(const Grid& g, int quadrant);
+  };
+}
+
+#endif //NULLP0INT_PATHFINDINGVISIBILITY_H
@@ -0,0 +1,90 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "WorkerPool.h"
+
+namespace ecs::npc
+{
+  WorkerPool::WorkerPool(const unsigned workerCount)
+  {
+    m_threads.reserve(workerCount);
+    for (unsigned i = 0; i < workerCount; ++i)
+    {
+      m_threads.emplace_back(&WorkerPool::workerLoop, this);
+    }
+  }
+
+  WorkerPool::~WorkerPool()
+  {
+    {
+      std::lock_guard lock(m_mutex);
+      m_stopping = true;
+    }
+    m_wake.notify_all();
+
+    for (auto& t : m_threads)
+    {
+      if (t.joinable()) t.join();
+    }
+  }
+
+  void WorkerPool::parallelFor(const std::size_t count, const std::function<void(std::size_t)>& fn)
+  {
+    if (count == 0) return;
+
+    if (m_threads.empty() || count == 1)
+    {
+      for (std::size_t i = 0; i < count; ++i) fn(i);
+      return;
+    }
+
+    {
+      std::lock_guard lock(m_mutex);
+      m_job = &fn;
+      m_count = count;
+      m_next.store(0, std::memory_order_relaxed);
+      m_busy = m_threads.size();
+      ++m_round;
+    }
+    m_wake.notify_all();
+
+    drain();
+
+    std::unique_lock lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busy == 0; });
+    m_job = nullptr;
+  }
+
+  void WorkerPool::workerLoop()
+  {
+    std::uint64_t seenRound = 0;
+
+    while (true)
+    {
+      {
+        std::unique_lock lock(m_mutex);
+        m_wake.wait(lock, [&] { return m_stopping || m_round != seenRound; });
+        if (m_stopping) return;
+        seenRound = m_round;
+      }
+
+      drain();
+
+      {
+        std::lock_guard lock(m_mutex);
+        if (--m_busy == 0) m_done.notify_one();
+      }
+    }
+  }
+
+  void WorkerPool::drain()
+  {
+    const auto& fn = *m_job;
+    for (std::size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < m_count;
+         i = m_next.fetch_add(1, std::memory_order_relaxed))
+    {
+      fn(i);
+    }
+  }
+}
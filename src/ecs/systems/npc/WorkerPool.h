@@ -0,0 +1,50 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_WORKERPOOL_H
+#define NULLP0INT_WORKERPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ecs::npc
+{
+  class WorkerPool
+  {
+  public:
+    explicit WorkerPool(unsigned workerCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    [[nodiscard]] std::size_t workerCount() const { return m_threads.size(); }
+
+    void parallelFor(std::size_t count, const std::function<void(std::size_t)>& fn);
+
+  private:
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+
+    const std::function<void(std::size_t)>* m_job = nullptr;
+    std::size_t m_count = 0;
+    std::atomic<std::size_t> m_next{0};
+    std::size_t m_busy = 0;
+    std::uint64_t m_round = 0;
+    bool m_stopping = false;
+
+    void workerLoop();
+    void drain();
+  };
+}
+
+#endif //NULLP0INT_WORKERPOOL_H
@@ -0,0 +1,100 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "InterpolationSystem.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../Components.h"
+
+namespace
+{
+  [[nodiscard]] float lerpAngleDegrees(const float from, const float to, const float t)
+  {
+    const float delta = std::remainder(to - from, 360.f);
+    float angle = from + delta * t;
+    if (angle >= 360.f) angle -= 360.f;
+    if (angle < 0.f) angle += 360.f;
+    return angle;
+  }
+}
+
+void ecs::InterpolationSystem::snapshot(Registry& registry)
+{
+  for (const auto e : registry.entities())
+  {
+    auto* interp = registry.getComponent<InterpolationComponent>(e);
+    if (!interp)
+    {
+      snap(registry, e);
+      continue;
+    }
+
+    const auto* pos = registry.getComponent<PositionComponent>(e);
+    if (!pos) continue;
+
+    const auto* rot = registry.getComponent<RotationComponent>(e);
+    interp->previousPosition = pos->position;
+    interp->previousAngle = rot ? rot->angle : 0.f;
+  }
+}
+
+void ecs::InterpolationSystem::snap(Registry& registry, const Entity e)
+{
+  const auto* pos = registry.getComponent<PositionComponent>(e);
+  if (!pos) return;
+
+  const auto* rot = registry.getComponent<RotationComponent>(e);
+  const float angle = rot ? rot->angle : 0.f;
+
+  if (auto* interp = registry.getComponent<InterpolationComponent>(e))
+  {
+    *interp = {pos->position, angle, pos->position, angle};
+    return;
+  }
+
+  registry.addComponent<InterpolationComponent>(e, {pos->position, angle, pos->position, angle});
+}
+
+void ecs::InterpolationSystem::apply(Registry& registry, const float alpha)
+{
+  const float t = std::clamp(alpha, 0.f, 1.f);
+
+  for (const auto e : registry.entities())
+  {
+    auto* interp = registry.getComponent<InterpolationComponent>(e);
+    if (!interp) continue;
+
+    auto* pos = registry.getComponent<PositionComponent>(e);
+    if (!pos) continue;
+
+    interp->currentPosition = pos->position;
+    pos->position = interp->previousPosition + (interp->currentPosition - interp->previousPosition) * t;
+
+    if (auto* rot = registry.getComponent<RotationComponent>(e))
+    {
+      interp->currentAngle = rot->angle;
+      rot->angle = lerpAngleDegrees(interp->previousAngle, interp->currentAngle, t);
+    }
+  }
+}
+
+void ecs::InterpolationSystem::restore(Registry& registry)
+{
+  for (const auto e : registry.entities())
+  {
+    const auto* interp = registry.getComponent<InterpolationComponent>(e);
+    if (!interp) continue;
+
+    if (auto* pos = registry.getComponent<PositionComponent>(e))
+    {
+      pos->position = interp->currentPosition;
+    }
+    if (auto* rot = registry.getComponent<RotationComponent>(e))
+    {
+      rot->angle = interp->currentAngle;
+    }
+  }
+}
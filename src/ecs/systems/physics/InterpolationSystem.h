@@ -0,0 +1,22 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_INTERPOLATIONSYSTEM_H
+#define NULLP0INT_INTERPOLATIONSYSTEM_H
+
+#include "../../Registry.h"
+
+namespace ecs
+{
+  class InterpolationSystem
+  {
+  public:
+    static void snapshot(Registry& registry);
+    static void snap(Registry& registry, Entity e);
+    static void apply(Registry& registry, float alpha);
+    static void restore(Registry& registry);
+  };
+}
+
+#endif //NULLP0INT_INTERPOLATIONSYSTEM_H
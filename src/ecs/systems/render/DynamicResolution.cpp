@@ -0,0 +1,55 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../../constants.h"
+
+namespace ecs
+{
+  void DynamicResolution::update(const float frameWorkSeconds, Configuration& config)
+  {
+    if (!m_captured)
+    {
+      m_baseRays = config.resolution_option;
+      m_baseScale = config.render_scale;
+      m_captured = true;
+    }
+
+    if (!config.dynamic_resolution || !(frameWorkSeconds > 0.f) || !std::isfinite(frameWorkSeconds)) return;
+
+    const float target = config.target_frame_ms / 1000.f;
+    m_averageSeconds = (m_averageSeconds > 0.f)
+      ? m_averageSeconds + (frameWorkSeconds - m_averageSeconds) * DYNAMIC_RES_SMOOTHING
+      : frameWorkSeconds;
+    ++m_framesSinceChange;
+
+    int next = m_level;
+    if (m_averageSeconds > target && m_framesSinceChange >= DYNAMIC_RES_DOWNGRADE_FRAMES)
+    {
+      next = std::min(m_level + 1, STEP_COUNT - 1);
+    }
+    else if (m_averageSeconds < target * DYNAMIC_RES_UPGRADE_HEADROOM && m_framesSinceChange >= DYNAMIC_RES_UPGRADE_FRAMES)
+    {
+      next = std::max(m_level - 1, 0);
+    }
+
+    if (next == m_level) return;
+
+    m_level = next;
+    m_framesSinceChange = 0;
+    apply(config);
+  }
+
+  void DynamicResolution::apply(Configuration& config) const
+  {
+    const Step& step = STEPS[m_level];
+    const float rays = std::round(m_baseRays * step.rayFactor);
+    config.resolution_option = std::max(rays, static_cast<float>(ResolutionOption::EXTRA_LOW));
+    config.render_scale = std::clamp(m_baseScale * step.scaleFactor, MIN_RENDER_SCALE, 1.f);
+  }
+}
@@ -0,0 +1,47 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_DYNAMICRESOLUTION_H
+#define NULLP0INT_DYNAMICRESOLUTION_H
+
+#include "../../../configuration/Configuration.h"
+
+namespace ecs
+{
+  class DynamicResolution
+  {
+  public:
+    void update(float frameWorkSeconds, Configuration& config);
+
+  private:
+    struct Step
+    {
+      float rayFactor;
+      float scaleFactor;
+    };
+
+    static constexpr Step STEPS[] = {
+      {1.00f, 1.00f},
+      {0.80f, 1.00f},
+      {0.66f, 0.90f},
+      {0.50f, 0.80f},
+      {0.40f, 0.70f},
+      {0.33f, 0.60f},
+      {0.25f, 0.50f},
+    };
+    static constexpr int STEP_COUNT = static_cast<int>(sizeof(STEPS) / sizeof(STEPS[0]));
+
+    bool m_captured = false;
+    float m_baseRays = 0.f;
+    float m_baseScale = 1.f;
+
+    int m_level = 0;
+    float m_averageSeconds = 0.f;
+    int m_framesSinceChange = 0;
+
+    void apply(Configuration& config) const;
+  };
+}
+
+#endif //NULLP0INT_DYNAMICRESOLUTION_H
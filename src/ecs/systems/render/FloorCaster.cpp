@@ -0,0 +1,392 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "FloorCaster.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define NULLP0INT_FLOOR_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NULLP0INT_FLOOR_SSE2 1
+#endif
+
+#include "../../../constants.h"
+#include "../../../math/mathUtils.h"
+
+namespace
+{
+  constexpr float kFracScale = 65536.f;
+  constexpr float kFracMax = 65535.f;
+
+  [[nodiscard]] std::uint32_t packColor(const sf::Uint8 r, const sf::Uint8 g, const sf::Uint8 b, const sf::Uint8 a)
+  {
+    const sf::Uint8 bytes[4] = {r, g, b, a};
+    std::uint32_t v;
+    std::memcpy(&v, bytes, sizeof(v));
+    return v;
+  }
+
+  [[nodiscard]] unsigned roundUpTo8(const unsigned v)
+  {
+    return (v + 7u) & ~7u;
+  }
+}
+
+namespace ecs
+{
+  void FloorCaster::resize(const unsigned width, const unsigned height)
+  {
+    m_width = width;
+    m_height = height;
+    m_pixels.assign(static_cast<std::size_t>(width) * height, 0u);
+
+    const unsigned padded = roundUpTo8(width);
+    m_tileX.assign(padded, 0);
+    m_tileY.assign(padded, 0);
+    m_fracU.assign(padded, 0);
+    m_fracV.assign(padded, 0);
+    m_levels.assign(padded, 0);
+
+    (void)m_texture.create(width, height);
+    m_texture.setSmooth(false);
+    m_sprite.setTexture(m_texture, true);
+    m_sprite.setPosition(0.f, 0.f);
+    m_sprite.setScale(static_cast<float>(SCREEN_WIDTH) / static_cast<float>(width), static_cast<float>(SCREEN_HEIGHT) / static_cast<float>(height));
+  }
+
+  void FloorCaster::resolveSources(const TilemapComponent& map, const TextureManager& textureManager)
+  {
+    auto resolve = [&](const std::string& id, std::vector<TexelSource>& mips)
+    {
+      mips.clear();
+      if (id.empty()) return;
+
+      const int levels = textureManager.mipLevelCount(id);
+      for (int level = 0; level < levels; ++level)
+      {
+        const sf::Image* image = textureManager.getImage(id, level);
+        if (!image) break;
+
+        const sf::Vector2u size = image->getSize();
+        if (size.x == 0u || size.y == 0u || !image->getPixelsPtr()) break;
+
+        mips.push_back(TexelSource{image->getPixelsPtr(), static_cast<int>(size.x), static_cast<int>(size.y)});
+      }
+    };
+
+    m_floorMips.resize(map.floorTexturePalette.size() + 1u);
+    resolve(map.floorTextureId, m_floorMips.front());
+    for (std::size_t i = 0; i < map.floorTexturePalette.size(); ++i)
+    {
+      resolve(map.floorTexturePalette[i], m_floorMips[i + 1u]);
+    }
+
+    resolve(map.ceilingTextureId, m_ceilingMips);
+    m_floorSources.resize(m_floorMips.size());
+  }
+
+  void FloorCaster::selectRowSources(const float tilesPerPixel)
+  {
+    auto pick = [&](const std::vector<TexelSource>& mips) -> TexelSource
+    {
+      if (mips.empty()) return {};
+      const int mip = TextureManager::selectMipLevel(tilesPerPixel * static_cast<float>(mips.front().width));
+      return mips[static_cast<std::size_t>(std::min(mip, static_cast<int>(mips.size()) - 1))];
+    };
+
+    for (std::size_t i = 0; i < m_floorMips.size(); ++i)
+    {
+      m_floorSources[i] = pick(m_floorMips[i]);
+    }
+    m_ceilingSource = pick(m_ceilingMips);
+  }
+
+  void FloorCaster::computeRowCoords(
+    const float startX,
+    const float startY,
+    const float stepX,
+    const float stepY,
+    const float invTileSize,
+    std::int32_t* tileX,
+    std::int32_t* tileY,
+    std::int32_t* fracU,
+    std::int32_t* fracV,
+    const unsigned count
+  )
+  {
+#if defined(NULLP0INT_FLOOR_AVX2)
+    const __m256 lane = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+    const __m256 vStartX = _mm256_set1_ps(startX * invTileSize);
+    const __m256 vStartY = _mm256_set1_ps(startY * invTileSize);
+    const __m256 vStepX = _mm256_set1_ps(stepX * invTileSize);
+    const __m256 vStepY = _mm256_set1_ps(stepY * invTileSize);
+    const __m256 vScale = _mm256_set1_ps(kFracScale);
+    const __m256 vMax = _mm256_set1_ps(kFracMax);
+
+    for (unsigned i = 0; i < count; i += 8)
+    {
+      const __m256 xi = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(i)), lane);
+      const __m256 tx = _mm256_add_ps(vStartX, _mm256_mul_ps(xi, vStepX));
+      const __m256 ty = _mm256_add_ps(vStartY, _mm256_mul_ps(xi, vStepY));
+
+      const __m256 fx = _mm256_floor_ps(tx);
+      const __m256 fy = _mm256_floor_ps(ty);
+
+      const __m256 fu = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(tx, fx), vScale), vMax);
+      const __m256 fv = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(ty, fy), vScale), vMax);
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(tileX + i), _mm256_cvttps_epi32(fx));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(tileY + i), _mm256_cvttps_epi32(fy));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(fracU + i), _mm256_cvttps_epi32(fu));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(fracV + i), _mm256_cvttps_epi32(fv));
+    }
+#elif defined(NULLP0INT_FLOOR_SSE2)
+    const __m128 vStartX = _mm_set1_ps(startX * invTileSize);
+    const __m128 vStartY = _mm_set1_ps(startY * invTileSize);
+    const __m128 vStepX = _mm_set1_ps(stepX * invTileSize);
+    const __m128 vStepY = _mm_set1_ps(stepY * invTileSize);
+    const __m128 vScale = _mm_set1_ps(kFracScale);
+    const __m128 vMax = _mm_set1_ps(kFracMax);
+
+    auto floorToInt = [](const __m128 v) -> __m128i
+    {
+      const __m128i t = _mm_cvttps_epi32(v);
+      const __m128 tf = _mm_cvtepi32_ps(t);
+      return _mm_add_epi32(t, _mm_castps_si128(_mm_cmpgt_ps(tf, v)));
+    };
+
+    auto step4 = [&](const unsigned i)
+    {
+      const __m128 xi = _mm_add_ps(_mm_set1_ps(static_cast<float>(i)), _mm_setr_ps(0.f, 1.f, 2.f, 3.f));
+      const __m128 tx = _mm_add_ps(vStartX, _mm_mul_ps(xi, vStepX));
+      const __m128 ty = _mm_add_ps(vStartY, _mm_mul_ps(xi, vStepY));
+
+      const __m128i ix = floorToInt(tx);
+      const __m128i iy = floorToInt(ty);
+
+      const __m128 fu = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(tx, _mm_cvtepi32_ps(ix)), vScale), vMax);
+      const __m128 fv = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(ty, _mm_cvtepi32_ps(iy)), vScale), vMax);
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(tileX + i), ix);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(tileY + i), iy);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(fracU + i), _mm_cvttps_epi32(fu));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(fracV + i), _mm_cvttps_epi32(fv));
+    };
+
+    for (unsigned i = 0; i < count; i += 8)
+    {
+      step4(i);
+      step4(i + 4);
+    }
+#else
+    for (unsigned i = 0; i < count; ++i)
+    {
+      const float tx = (startX + static_cast<float>(i) * stepX) * invTileSize;
+      const float ty = (startY + static_cast<float>(i) * stepY) * invTileSize;
+      const float fx = std::floor(tx);
+      const float fy = std::floor(ty);
+
+      tileX[i] = static_cast<std::int32_t>(fx);
+      tileY[i] = static_cast<std::int32_t>(fy);
+      fracU[i] = static_cast<std::int32_t>(std::min((tx - fx) * kFracScale, kFracMax));
+      fracV[i] = static_cast<std::int32_t>(std::min((ty - fy) * kFracScale, kFracMax));
+    }
+#endif
+  }
+
+  void FloorCaster::shadeRow(std::uint32_t* row, const std::uint8_t* levels, const unsigned count, const LightTable& lights)
+  {
+    unsigned i = 0;
+
+#if defined(NULLP0INT_FLOOR_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i round = _mm256_set1_epi16(128);
+    const __m256i spread = _mm256_set1_epi32(0x00010101);
+    const __m256i alpha = _mm256_set1_epi32(static_cast<int>(packColor(0, 0, 0, 255)));
+
+    auto scale = [&](const __m256i v, const __m256i l)
+    {
+      const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(v, l), round);
+      return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+    };
+
+    for (; i + 8 <= count; i += 8)
+    {
+      const __m256i px = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i));
+      const __m128i l8 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(levels + i));
+      const __m256i lv = _mm256_mullo_epi32(_mm256_cvtepu8_epi32(l8), spread);
+      const __m256i lo = scale(_mm256_unpacklo_epi8(px, zero), _mm256_unpacklo_epi8(lv, zero));
+      const __m256i hi = scale(_mm256_unpackhi_epi8(px, zero), _mm256_unpackhi_epi8(lv, zero));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(row + i), _mm256_or_si256(_mm256_packus_epi16(lo, hi), alpha));
+    }
+#elif defined(NULLP0INT_FLOOR_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi16(128);
+    const __m128i alpha = _mm_set1_epi32(static_cast<int>(packColor(0, 0, 0, 255)));
+
+    auto scale = [&](const __m128i v, const __m128i l)
+    {
+      const __m128i t = _mm_add_epi16(_mm_mullo_epi16(v, l), round);
+      return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+    };
+
+    for (; i + 4 <= count; i += 4)
+    {
+      const __m128i px = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+      int packed;
+      std::memcpy(&packed, levels + i, sizeof(packed));
+      const __m128i l32 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+      const __m128i lv = _mm_or_si128(l32, _mm_or_si128(_mm_slli_epi32(l32, 8), _mm_slli_epi32(l32, 16)));
+      const __m128i lo = scale(_mm_unpacklo_epi8(px, zero), _mm_unpacklo_epi8(lv, zero));
+      const __m128i hi = scale(_mm_unpackhi_epi8(px, zero), _mm_unpackhi_epi8(lv, zero));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_or_si128(_mm_packus_epi16(lo, hi), alpha));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+      sf::Uint8 bytes[4];
+      std::memcpy(bytes, &row[i], sizeof(bytes));
+      bytes[0] = lights.shade(levels[i], bytes[0]);
+      bytes[1] = lights.shade(levels[i], bytes[1]);
+      bytes[2] = lights.shade(levels[i], bytes[2]);
+      bytes[3] = 255;
+      std::memcpy(&row[i], bytes, sizeof(bytes));
+    }
+  }
+
+  void FloorCaster::render(
+    sf::RenderTarget& target,
+    const TilemapComponent& map,
+    const RenderCamera& camera,
+    const TextureManager& textureManager,
+    const LightTable& lights,
+    const TileLightGrid& lightGrid,
+    const sf::Vector2f playerPos,
+    const float playerRotationAngle
+  )
+  {
+    const sf::Vector2u targetSize = target.getSize();
+    const unsigned bufferWidth = targetSize.x > 0u ? targetSize.x : SCREEN_WIDTH;
+    const unsigned bufferHeight = targetSize.y > 0u ? targetSize.y : SCREEN_HEIGHT;
+    if (m_width != bufferWidth || m_height != bufferHeight)
+    {
+      resize(bufferWidth, bufferHeight);
+    }
+
+    resolveSources(map, textureManager);
+
+    const float halfHeight = static_cast<float>(m_height) * 0.5f;
+    const float screenDist = camera.screenDist * static_cast<float>(m_width) / static_cast<float>(SCREEN_WIDTH);
+    const float invTileSize = 1.f / camera.tileSize;
+    const float maxRowDist = camera.attenuationDist * 2.f;
+
+    const float ang = radiansFromDegrees(playerRotationAngle);
+    const sf::Vector2f dir{ std::cos(ang), std::sin(ang) };
+    const sf::Vector2f plane{ -dir.y * camera.tanHalfFov, dir.x * camera.tanHalfFov };
+    const sf::Vector2f dirLeft = dir - plane;
+    const sf::Vector2f dirRight = dir + plane;
+
+    const std::uint32_t floorColor = packColor(50, 50, 50, 255);
+    const std::uint32_t ceilingColor = packColor(4, 2, 115, 255);
+
+    const bool perTileFloor = !map.floorTextureIndices.empty();
+    const TexelSource& defaultFloor = m_floorSources.front();
+    const TexelSource& ceiling = m_ceilingSource;
+    const float pixelSpan = std::hypot(dirRight.x - dirLeft.x, dirRight.y - dirLeft.y) / static_cast<float>(m_width);
+
+    auto sample = [](const TexelSource& src, const std::int32_t fu, const std::int32_t fv) -> std::uint32_t
+    {
+      const int u = (fu * src.width) >> 16;
+      const int v = (fv * src.height) >> 16;
+      std::uint32_t texel;
+      std::memcpy(&texel, src.texels + (static_cast<std::size_t>(v) * src.width + u) * 4u, sizeof(texel));
+      return texel;
+    };
+
+    const unsigned w = m_width;
+    const unsigned half = m_height / 2u;
+
+    for (unsigned y = half; y < m_height; ++y)
+    {
+      float p = static_cast<float>(y) - halfHeight;
+      if (std::abs(p) < SMALL_EPSILON)
+      {
+        p = SMALL_EPSILON;
+      }
+
+      float rowDistance = (camera.eyeHeight * screenDist) / p;
+      if (!std::isfinite(rowDistance)) continue;
+      rowDistance = std::min(rowDistance, maxRowDist);
+
+      const float startX = playerPos.x + dirLeft.x * rowDistance;
+      const float startY = playerPos.y + dirLeft.y * rowDistance;
+      const float stepX = (dirRight.x - dirLeft.x) * rowDistance / static_cast<float>(w);
+      const float stepY = (dirRight.y - dirLeft.y) * rowDistance / static_cast<float>(w);
+
+      const float depthSpan = rowDistance / p;
+      selectRowSources(camera.mipmapping ? std::max(pixelSpan * rowDistance, depthSpan) * invTileSize : 0.f);
+
+      computeRowCoords(startX, startY, stepX, stepY, invTileSize,
+                       m_tileX.data(), m_tileY.data(), m_fracU.data(), m_fracV.data(), w);
+
+      std::uint32_t* floorRow = m_pixels.data() + static_cast<std::size_t>(y) * w;
+      const unsigned ceilingY = m_height - 1u - y;
+      std::uint32_t* ceilingRow = (ceilingY < half) ? m_pixels.data() + static_cast<std::size_t>(ceilingY) * w : nullptr;
+
+      const std::uint8_t rowLevel = lights.level(rowDistance);
+
+      if (camera.tileLighting)
+      {
+        const std::uint8_t* rowLit = lights.litLevels(rowLevel);
+        for (unsigned x = 0; x < w; ++x)
+        {
+          m_levels[x] = std::max(rowLit[lightGrid.at(m_tileX[x], m_tileY[x])], LightTable::MIN_WALL_LIGHT);
+        }
+      }
+      else
+      {
+        std::fill_n(m_levels.data(), w, std::max(rowLevel, LightTable::MIN_WALL_LIGHT));
+      }
+
+      for (unsigned x = 0; x < w; ++x)
+      {
+        const TexelSource* src = &defaultFloor;
+        if (perTileFloor)
+        {
+          const std::uint8_t idx = map.floorTextureIndexAt(m_tileX[x], m_tileY[x]);
+          if (idx < m_floorSources.size()) src = &m_floorSources[idx];
+        }
+
+        floorRow[x] = src->texels ? sample(*src, m_fracU[x], m_fracV[x]) : floorColor;
+      }
+
+      if (ceilingRow)
+      {
+        if (ceiling.texels)
+        {
+          for (unsigned x = 0; x < w; ++x)
+          {
+            ceilingRow[x] = sample(ceiling, m_fracU[x], m_fracV[x]);
+          }
+        }
+        else
+        {
+          std::fill_n(ceilingRow, w, ceilingColor);
+        }
+      }
+
+      shadeRow(floorRow, m_levels.data(), w, lights);
+      if (ceilingRow && ceiling.texels) shadeRow(ceilingRow, m_levels.data(), w, lights);
+    }
+
+    m_texture.update(reinterpret_cast<const sf::Uint8*>(m_pixels.data()));
+    target.draw(m_sprite);
+  }
+}
@@ -0,0 +1,72 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_FLOORCASTER_H
+#define NULLP0INT_FLOORCASTER_H
+
+#include <cstdint>
+#include <vector>
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include "LightTable.h"
+#include "RenderCamera.h"
+#include "TextureManager.h"
+#include "TileLightGrid.h"
+#include "../../Components.h"
+
+namespace ecs
+{
+  class FloorCaster
+  {
+  public:
+    void render(sf::RenderTarget& target,
+                const TilemapComponent& map,
+                const RenderCamera& camera,
+                const TextureManager& textureManager,
+                const LightTable& lights,
+                const TileLightGrid& lightGrid,
+                sf::Vector2f playerPos,
+                float playerRotationAngle);
+
+  private:
+    struct TexelSource
+    {
+      const std::uint8_t* texels = nullptr;
+      int width = 0;
+      int height = 0;
+    };
+
+    unsigned m_width = 0;
+    unsigned m_height = 0;
+    std::vector<std::uint32_t> m_pixels;
+    sf::Texture m_texture;
+    sf::Sprite m_sprite;
+
+    std::vector<std::vector<TexelSource>> m_floorMips;
+    std::vector<TexelSource> m_ceilingMips;
+    std::vector<TexelSource> m_floorSources;
+    TexelSource m_ceilingSource;
+
+    std::vector<std::int32_t> m_tileX;
+    std::vector<std::int32_t> m_tileY;
+    std::vector<std::int32_t> m_fracU;
+    std::vector<std::int32_t> m_fracV;
+    std::vector<std::uint8_t> m_levels;
+
+    void resize(unsigned width, unsigned height);
+    void resolveSources(const TilemapComponent& map, const TextureManager& textureManager);
+    void selectRowSources(float tilesPerPixel);
+
+    static void computeRowCoords(float startX, float startY, float stepX, float stepY, float invTileSize,
+                                 std::int32_t* tileX, std::int32_t* tileY, std::int32_t* fracU, std::int32_t* fracV,
+                                 unsigned count);
+    static void shadeRow(std::uint32_t* row, const std::uint8_t* levels, unsigned count, const LightTable& lights);
+  };
+}
+
+#endif //NULLP0INT_FLOORCASTER_H
@@ -0,0 +1,43 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "LightTable.h"
+
+#include "../../../constants.h"
+
+namespace ecs
+{
+  LightTable::LightTable()
+  {
+    for (int l = 0; l < 256; ++l)
+    {
+      for (int v = 0; v < 256; ++v)
+      {
+        const int t = v * l + 128;
+        m_colormap[static_cast<std::size_t>(l)][static_cast<std::size_t>(v)] = static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+
+        const int lit = (v * l + LIGHTMAP_AMBIENT / 2) / LIGHTMAP_AMBIENT;
+        m_lit[static_cast<std::size_t>(l)][static_cast<std::size_t>(v)] = static_cast<std::uint8_t>(std::min(lit, 255));
+      }
+    }
+  }
+
+  void LightTable::rebuildIfNeeded(const Configuration& config)
+  {
+    if (config.attenuation_distance == m_attenuationDistance && config.tile_size == m_tileSize) return;
+
+    m_attenuationDistance = config.attenuation_distance;
+    m_tileSize = config.tile_size;
+
+    const float maxAttenuationDist = std::max(config.attenuation_distance * config.tile_size, 1e-3f);
+    m_invBandSize = static_cast<float>(DISTANCE_BANDS) / maxAttenuationDist;
+
+    for (int i = 0; i < DISTANCE_BANDS; ++i)
+    {
+      const float brightness = 1.f - std::min(static_cast<float>(i) / static_cast<float>(DISTANCE_BANDS), 1.f);
+      m_levels[static_cast<std::size_t>(i)] = static_cast<std::uint8_t>(std::clamp(brightness * 255.f, 0.f, 255.f));
+    }
+    m_levels.back() = 0;
+  }
+}
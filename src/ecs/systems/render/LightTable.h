@@ -0,0 +1,80 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_LIGHTTABLE_H
+#define NULLP0INT_LIGHTTABLE_H
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <SFML/Graphics/Color.hpp>
+
+#include "../../../configuration/Configuration.h"
+
+namespace ecs
+{
+  class LightTable
+  {
+  public:
+    static constexpr int DISTANCE_BANDS = 256;
+    static constexpr std::uint8_t MIN_WALL_LIGHT = 30;
+    static constexpr std::uint8_t MIN_PROJECTILE_LIGHT = 40;
+
+    LightTable();
+
+    void rebuildIfNeeded(const Configuration& config);
+
+    [[nodiscard]] std::uint8_t level(const float depth) const
+    {
+      if (!(depth > 0.f)) return m_levels.front();
+      const float band = depth * m_invBandSize;
+      if (band >= static_cast<float>(DISTANCE_BANDS - 1)) return m_levels.back();
+      return m_levels[static_cast<std::size_t>(band)];
+    }
+
+    [[nodiscard]] std::uint8_t level(const float depth, const std::uint8_t minLevel) const
+    {
+      return std::max(level(depth), minLevel);
+    }
+
+    [[nodiscard]] std::uint8_t level(const float depth, const std::uint8_t tileLight, const std::uint8_t minLevel) const
+    {
+      return std::max(m_lit[level(depth)][tileLight], minLevel);
+    }
+
+    [[nodiscard]] sf::Color tint(const float depth, const std::uint8_t minLevel) const
+    {
+      const std::uint8_t l = level(depth, minLevel);
+      return {l, l, l};
+    }
+
+    [[nodiscard]] sf::Color tint(const float depth, const std::uint8_t tileLight, const std::uint8_t minLevel) const
+    {
+      const std::uint8_t l = level(depth, tileLight, minLevel);
+      return {l, l, l};
+    }
+
+    [[nodiscard]] std::uint8_t shade(const std::uint8_t lightLevel, const std::uint8_t value) const
+    {
+      return m_colormap[lightLevel][value];
+    }
+
+    [[nodiscard]] const std::uint8_t* litLevels(const std::uint8_t lightLevel) const
+    {
+      return m_lit[lightLevel].data();
+    }
+
+  private:
+    float m_attenuationDistance = -1.f;
+    float m_tileSize = -1.f;
+    float m_invBandSize = 0.f;
+
+    std::array<std::uint8_t, DISTANCE_BANDS> m_levels{};
+    std::array<std::array<std::uint8_t, 256>, 256> m_colormap{};
+    std::array<std::array<std::uint8_t, 256>, 256> m_lit{};
+  };
+}
+
+#endif //NULLP0INT_LIGHTTABLE_H
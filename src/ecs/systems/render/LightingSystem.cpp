@@ -0,0 +1,22 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "LightingSystem.h"
+#include "../../Components.h"
+
+void ecs::LightingSystem::update(Registry &registry, const float dt)
+{
+  for (const auto e : registry.entities())
+  {
+    auto* light = registry.getComponent<PointLightComponent>(e);
+    if (!light) continue;
+    if (light->remainingSeconds < 0.f) continue;
+
+    light->remainingSeconds -= dt;
+    if (light->remainingSeconds <= 0.f)
+    {
+      registry.removeComponent<PointLightComponent>(e);
+    }
+  }
+}
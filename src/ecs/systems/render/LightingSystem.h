@@ -0,0 +1,19 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_LIGHTINGSYSTEM_H
+#define NULLP0INT_LIGHTINGSYSTEM_H
+
+#include "../../Registry.h"
+
+namespace ecs
+{
+  class LightingSystem
+  {
+  public:
+    static void update(Registry& registry, float dt);
+  };
+}
+
+#endif //NULLP0INT_LIGHTINGSYSTEM_H
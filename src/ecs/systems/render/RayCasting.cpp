@@ -4,8 +4,10 @@
 
 #include "RayCasting.h"
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 #include "../../Components.h"
 #include "../../Registry.h"
@@ -58,6 +60,26 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
     result->hits.clear();
     result->hits.reserve(amount_of_rays);
 
+    if (config.wall_renderer == WallRenderer::SEGMENTS && !map->wallSegments.empty())
+    {
+        result->resetVisibleTiles(map->width, map->height);
+        result->markVisibleTile(static_cast<int>(std::floor(playerTileX)), static_cast<int>(std::floor(playerTileY)));
+        castSegments(*result, *map, config, playerTileX, playerTileY, viewDirectionAngle);
+        return;
+    }
+
+    result->resetVisibleTiles(map->width, map->height);
+    result->markVisibleTile(static_cast<int>(std::floor(playerTileX)), static_cast<int>(std::floor(playerTileY)));
+
+    struct TileCrossing
+    {
+        double dist;
+        int tx;
+        int ty;
+    };
+    std::vector<TileCrossing> horizontalCrossings;
+    std::vector<TileCrossing> verticalCrossings;
+
     double rayAngle = (viewDirectionAngle - half_fov) + static_cast<double>(RAY_ANGLE_OFFSET);
 
     for (unsigned r = 0; r < amount_of_rays; ++r)
@@ -67,6 +89,8 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
 
         double nearestHorizontalDist = std::numeric_limits<double>::infinity();
         double horizontalHitTileX = 0.0, horizontalHitTileY = 0.0;
+        horizontalCrossings.clear();
+        verticalCrossings.clear();
 
         if (std::abs(sin_a) > static_cast<double>(BIG_EPSILON))
         {
@@ -90,6 +114,7 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
                     horizontalHitTileY = y;
                     break;
                 }
+                horizontalCrossings.push_back(TileCrossing{distToNextHorizontal, tx, ty});
                 x_h += horizontalXStep;
                 y += dy;
                 distToNextHorizontal += horizontalDistStep;
@@ -121,6 +146,7 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
                     verticalHitTileY = y_v;
                     break;
                 }
+                verticalCrossings.push_back(TileCrossing{distToNextVertical, tx, ty});
                 x += dx;
                 y_v += verticalYStep;
                 distToNextVertical += verticalDistStep;
@@ -151,6 +177,17 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
             chosenHitTileIndexX = static_cast<int>(std::floor(verticalHitTileX));
             chosenHitTileIndexY = static_cast<int>(std::floor(verticalHitTileY));
         }
+        for (const auto& c : horizontalCrossings)
+        {
+            if (c.dist >= depthTiles) break;
+            result->markVisibleTile(c.tx, c.ty);
+        }
+        for (const auto& c : verticalCrossings)
+        {
+            if (c.dist >= depthTiles) break;
+            result->markVisibleTile(c.tx, c.ty);
+        }
+
         const double depthWorld = depthTiles * tileSize;
         const sf::Vector2f hitPointWorld{ static_cast<float>(chosenHitTileX * tileSize), static_cast<float>(chosenHitTileY * tileSize) };
 
@@ -159,6 +196,8 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
         hit.distance = static_cast<float>(depthWorld);
         hit.tileX = chosenHitTileIndexX;
         hit.tileY = chosenHitTileIndexY;
+        hit.faceTileX = chosenVertical ? chosenHitTileIndexX + (cos_a > 0.0 ? -1 : 1) : chosenHitTileIndexX;
+        hit.faceTileY = chosenVertical ? chosenHitTileIndexY : chosenHitTileIndexY + (sin_a > 0.0 ? -1 : 1);
         hit.vertical = chosenVertical;
         hit.rayAngle = static_cast<float>(rayAngle);
 
@@ -167,3 +206,242 @@ void ecs::RayCasting::rayCast(Registry &registry, Configuration config, const En
         rayAngle += static_cast<double>(delta_angle);
     }
 }
+
+void ecs::RayCasting::castSegments(RayCastResultComponent& result, const TilemapComponent& map, const Configuration& config,
+                                   const double playerTileX, const double playerTileY, const double viewDirectionAngle)
+{
+    const auto amount_of_rays = static_cast<unsigned>(config.resolution_option);
+    const auto half_fov = static_cast<double>(config.fov) / 2.0;
+    const auto delta_angle = static_cast<double>(config.fov) / static_cast<double>(amount_of_rays);
+    const auto max_depth = static_cast<double>(config.render_distance);
+    const auto tileSize = static_cast<double>(map.tileSize);
+    const double startAngle = (viewDirectionAngle - half_fov) + static_cast<double>(RAY_ANGLE_OFFSET);
+    const double viewX = std::cos(viewDirectionAngle);
+    const double viewY = std::sin(viewDirectionAngle);
+
+    m_candidates.clear();
+    m_columnDepth.assign(amount_of_rays, std::numeric_limits<double>::infinity());
+    m_columnOwner.assign(amount_of_rays, -1);
+
+    auto columnOf = [&](const double x, const double y)
+    {
+        const double rel = std::atan2(viewX * y - viewY * x, viewX * x + viewY * y);
+        return (rel + half_fov - static_cast<double>(RAY_ANGLE_OFFSET)) / delta_angle;
+    };
+
+    for (std::size_t i = 0; i < map.wallSegments.size(); ++i)
+    {
+        const WallSegment& seg = map.wallSegments[i];
+
+        const double facing = seg.isVertical()
+            ? (playerTileX - seg.start.x) * seg.normal.x
+            : (playerTileY - seg.start.y) * seg.normal.y;
+        if (facing <= 0.0) continue;
+
+        const double nx = std::clamp(playerTileX, static_cast<double>(seg.start.x), static_cast<double>(seg.end.x));
+        const double ny = std::clamp(playerTileY, static_cast<double>(seg.start.y), static_cast<double>(seg.end.y));
+        const double nearDist = std::hypot(nx - playerTileX, ny - playerTileY);
+        if (nearDist > max_depth) continue;
+
+        double ax = seg.start.x - playerTileX, ay = seg.start.y - playerTileY;
+        double bx = seg.end.x - playerTileX,   by = seg.end.y - playerTileY;
+        const double fa = ax * viewX + ay * viewY;
+        const double fb = bx * viewX + by * viewY;
+        if (fa <= BIG_EPSILON && fb <= BIG_EPSILON) continue;
+
+        if (fa <= BIG_EPSILON || fb <= BIG_EPSILON)
+        {
+            const double k = (BIG_EPSILON - fa) / (fb - fa);
+            const double cx = ax + (bx - ax) * k;
+            const double cy = ay + (by - ay) * k;
+            if (fa <= BIG_EPSILON) { ax = cx; ay = cy; }
+            else                   { bx = cx; by = cy; }
+        }
+
+        const double ca = columnOf(ax, ay);
+        const double cb = columnOf(bx, by);
+        const int c0 = std::max(0, static_cast<int>(std::ceil(std::min(ca, cb))));
+        const int c1 = std::min(static_cast<int>(amount_of_rays) - 1, static_cast<int>(std::floor(std::max(ca, cb))));
+        if (c0 > c1) continue;
+
+        m_candidates.push_back(Candidate{nearDist, i, c0, c1});
+    }
+
+    std::ranges::sort(m_candidates, {}, &Candidate::nearDist);
+
+    unsigned openColumns = amount_of_rays;
+    double farthestFilled = 0.0;
+
+    for (const auto& cand : m_candidates)
+    {
+        if (openColumns == 0 && cand.nearDist >= farthestFilled) break;
+
+        const WallSegment& seg = map.wallSegments[cand.index];
+        const int c0 = cand.c0;
+        const int c1 = cand.c1;
+
+        const double lo = seg.isVertical() ? seg.start.y : seg.start.x;
+        const double hi = seg.isVertical() ? seg.end.y : seg.end.x;
+
+        for (int c = c0; c <= c1; ++c)
+        {
+            double& depth = m_columnDepth[static_cast<std::size_t>(c)];
+            if (depth <= cand.nearDist) continue;
+
+            const double rayAngle = startAngle + static_cast<double>(c) * delta_angle;
+            const double dx = std::cos(rayAngle);
+            const double dy = std::sin(rayAngle);
+
+            double t, along;
+            if (seg.isVertical())
+            {
+                if (std::abs(dx) <= BIG_EPSILON) continue;
+                t = (seg.start.x - playerTileX) / dx;
+                along = playerTileY + t * dy;
+            }
+            else
+            {
+                if (std::abs(dy) <= BIG_EPSILON) continue;
+                t = (seg.start.y - playerTileY) / dy;
+                along = playerTileX + t * dx;
+            }
+
+            if (t <= 0.0 || t >= depth) continue;
+            if (along < lo - EPSILON_DIST || along > hi + EPSILON_DIST) continue;
+
+            if (!std::isfinite(depth)) --openColumns;
+            depth = t;
+            m_columnOwner[static_cast<std::size_t>(c)] = static_cast<int>(cand.index);
+            farthestFilled = std::max(farthestFilled, t);
+        }
+    }
+
+    markViewPolygon(result, map, playerTileX, playerTileY, startAngle, delta_angle, max_depth);
+
+    for (unsigned c = 0; c < amount_of_rays; ++c)
+    {
+        const double rayAngle = startAngle + static_cast<double>(c) * delta_angle;
+
+        RayHit hit;
+        hit.rayAngle = static_cast<float>(rayAngle);
+        hit.distance = std::numeric_limits<float>::infinity();
+
+        if (const int owner = m_columnOwner[c]; owner >= 0)
+        {
+            const WallSegment& seg = map.wallSegments[static_cast<std::size_t>(owner)];
+            const double depthTiles = m_columnDepth[c];
+            const double length = seg.isVertical() ? seg.end.y - seg.start.y : seg.end.x - seg.start.x;
+            const double along = seg.isVertical()
+                ? playerTileY + depthTiles * std::sin(rayAngle)
+                : playerTileX + depthTiles * std::cos(rayAngle);
+            const double offset = std::clamp(along - seg.textureOffset, 0.0, std::max(0.0, length - BIG_EPSILON));
+            const int tileAlong = static_cast<int>(std::floor(seg.textureOffset + offset));
+
+            hit.distance = static_cast<float>(depthTiles * tileSize);
+            hit.vertical = seg.isVertical();
+            if (hit.vertical)
+            {
+                hit.hitPointWorld = {static_cast<float>(seg.start.x * tileSize), static_cast<float>(along * tileSize)};
+                hit.tileX = static_cast<int>(seg.start.x) - (seg.normal.x > 0 ? 1 : 0);
+                hit.tileY = tileAlong;
+            }
+            else
+            {
+                hit.hitPointWorld = {static_cast<float>(along * tileSize), static_cast<float>(seg.start.y * tileSize)};
+                hit.tileX = tileAlong;
+                hit.tileY = static_cast<int>(seg.start.y) - (seg.normal.y > 0 ? 1 : 0);
+            }
+            hit.faceTileX = hit.tileX + seg.normal.x;
+            hit.faceTileY = hit.tileY + seg.normal.y;
+        }
+
+        result.hits.push_back(hit);
+    }
+}
+
+void ecs::RayCasting::markViewPolygon(RayCastResultComponent& result, const TilemapComponent& map, const double playerTileX, const double playerTileY,
+                                      const double startAngle, const double deltaAngle, const double maxDepth)
+{
+    const std::size_t rays = m_columnDepth.size();
+    const auto mapW = static_cast<double>(map.width);
+    const auto mapH = static_cast<double>(map.height);
+
+    auto reachOf = [&](const std::size_t c)
+    {
+        const double rayAngle = startAngle + static_cast<double>(c) * deltaAngle;
+        const double dx = std::cos(rayAngle);
+        const double dy = std::sin(rayAngle);
+
+        double reach = std::min(m_columnDepth[c], maxDepth);
+        if (dx > BIG_EPSILON)       reach = std::min(reach, (mapW - playerTileX) / dx);
+        else if (dx < -BIG_EPSILON) reach = std::min(reach, -playerTileX / dx);
+        if (dy > BIG_EPSILON)       reach = std::min(reach, (mapH - playerTileY) / dy);
+        else if (dy < -BIG_EPSILON) reach = std::min(reach, -playerTileY / dy);
+        reach = std::max(0.0, reach);
+
+        return ViewPoint{playerTileX + reach * dx, playerTileY + reach * dy};
+    };
+
+    m_viewPolygon.clear();
+    for (std::size_t c = 0; c < rays; ++c)
+    {
+        const int owner = m_columnOwner[c];
+        const bool startsSpan = c == 0 || owner < 0 || m_columnOwner[c - 1] != owner;
+        const bool endsSpan = c + 1 == rays || owner < 0 || m_columnOwner[c + 1] != owner;
+        if (startsSpan || endsSpan) m_viewPolygon.push_back(reachOf(c));
+    }
+
+    const ViewPoint eye{playerTileX, playerTileY};
+    for (std::size_t i = 0; i < m_viewPolygon.size(); ++i)
+    {
+        markTriangleTiles(result, map, eye, m_viewPolygon[i == 0 ? 0 : i - 1], m_viewPolygon[i]);
+    }
+}
+
+void ecs::RayCasting::markTriangleTiles(RayCastResultComponent& result, const TilemapComponent& map,
+                                        const ViewPoint a, const ViewPoint b, const ViewPoint c)
+{
+    const ViewPoint corners[3] = {a, b, c};
+    const double minY = std::min({a.y, b.y, c.y});
+    const double maxY = std::max({a.y, b.y, c.y});
+    const int ty0 = std::max(0, static_cast<int>(std::floor(minY)));
+    const int ty1 = std::min(static_cast<int>(map.height) - 1, static_cast<int>(std::floor(maxY)));
+
+    for (int ty = ty0; ty <= ty1; ++ty)
+    {
+        const double bandLo = std::max(minY, static_cast<double>(ty));
+        const double bandHi = std::min(maxY, static_cast<double>(ty) + 1.0);
+
+        double xMin = std::numeric_limits<double>::infinity();
+        double xMax = -std::numeric_limits<double>::infinity();
+        for (int e = 0; e < 3; ++e)
+        {
+            const ViewPoint& p = corners[e];
+            const ViewPoint& q = corners[(e + 1) % 3];
+
+            double t0 = 0.0, t1 = 1.0;
+            if (std::abs(q.y - p.y) > BIG_EPSILON)
+            {
+                const double ta = (bandLo - p.y) / (q.y - p.y);
+                const double tb = (bandHi - p.y) / (q.y - p.y);
+                t0 = std::max(0.0, std::min(ta, tb));
+                t1 = std::min(1.0, std::max(ta, tb));
+            }
+            else if (p.y < bandLo || p.y > bandHi) continue;
+            if (t0 > t1) continue;
+
+            const double x0 = p.x + (q.x - p.x) * t0;
+            const double x1 = p.x + (q.x - p.x) * t1;
+            xMin = std::min({xMin, x0, x1});
+            xMax = std::max({xMax, x0, x1});
+        }
+        if (xMin > xMax) continue;
+
+        const int tx0 = std::max(0, static_cast<int>(std::floor(xMin)));
+        const int tx1 = std::min(static_cast<int>(map.width) - 1, static_cast<int>(std::floor(xMax)));
+        for (int tx = tx0; tx <= tx1; ++tx)
+        {
+            result.markVisibleTile(tx, ty);
+        }
+    }
+}
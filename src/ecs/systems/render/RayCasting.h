@@ -5,6 +5,10 @@
 #ifndef NULLP0INT_RAYCASTING_H
 #define NULLP0INT_RAYCASTING_H
 
+#include <cstddef>
+#include <vector>
+
+#include "../../Components.h"
 #include "../../Registry.h"
 #include "../../../configuration/Configuration.h"
 
@@ -13,13 +17,38 @@ namespace ecs
   class RayCasting
   {
   public:
-    static void rayCast(Registry& registry, Configuration config, const Entity& player);
+    void rayCast(Registry& registry, Configuration config, const Entity& player);
 
   private:
+    struct Candidate
+    {
+      double nearDist;
+      std::size_t index;
+      int c0;
+      int c1;
+    };
+
+    struct ViewPoint
+    {
+      double x;
+      double y;
+    };
+
+    std::vector<Candidate> m_candidates;
+    std::vector<double> m_columnDepth;
+    std::vector<int> m_columnOwner;
+    std::vector<ViewPoint> m_viewPolygon;
+
     static Entity findTilemapEntity(const Registry& registry);
+    void castSegments(RayCastResultComponent& result, const TilemapComponent& map, const Configuration& config,
+                      double playerTileX, double playerTileY, double viewDirectionAngle);
+    void markViewPolygon(RayCastResultComponent& result, const TilemapComponent& map, double playerTileX, double playerTileY,
+                         double startAngle, double deltaAngle, double maxDepth);
+    static void markTriangleTiles(RayCastResultComponent& result, const TilemapComponent& map,
+                                  ViewPoint a, ViewPoint b, ViewPoint c);
   };
 }
 
 
 
-#endif //NULLP0INT_RAYCASTING_H
\ No newline at end of file
+#endif //NULLP0INT_RAYCASTING_H
@@ -0,0 +1,49 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "RenderCamera.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../../constants.h"
+
+namespace ecs
+{
+  bool RenderCamera::rebuildIfNeeded(const Configuration& config)
+  {
+    if (m_valid
+      && config.fov == m_source.fov
+      && config.resolution_option == m_source.resolution_option
+      && config.tile_size == m_source.tile_size
+      && config.player_eye_height == m_source.player_eye_height
+      && config.attenuation_distance == m_source.attenuation_distance
+      && config.enable_fish_eye == m_source.enable_fish_eye
+      && config.enable_tile_lighting == m_source.enable_tile_lighting
+      && config.enable_mipmaps == m_source.enable_mipmaps)
+    {
+      return false;
+    }
+
+    m_source = config;
+    m_valid = true;
+
+    fov = config.fov;
+    halfFov = fov / 2.f;
+    tanHalfFov = std::tan(halfFov);
+    screenDist = HALF_SCREEN_WIDTH / tanHalfFov;
+    tileSize = config.tile_size;
+    eyeHeight = config.player_eye_height;
+    attenuationDist = tileSize * config.attenuation_distance;
+
+    rays = std::max(1u, static_cast<unsigned>(config.resolution_option));
+    deltaAngle = fov / static_cast<float>(rays);
+    columnWidth = static_cast<float>(SCREEN_WIDTH) / static_cast<float>(rays);
+
+    fishEyeCorrection = config.enable_fish_eye;
+    tileLighting = config.enable_tile_lighting;
+    mipmapping = config.enable_mipmaps;
+    return true;
+  }
+}
@@ -0,0 +1,38 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_RENDERCAMERA_H
+#define NULLP0INT_RENDERCAMERA_H
+
+#include "../../../configuration/Configuration.h"
+
+namespace ecs
+{
+  struct RenderCamera
+  {
+    float fov = 0.f;
+    float halfFov = 0.f;
+    float tanHalfFov = 0.f;
+    float screenDist = 0.f;
+    float tileSize = 0.f;
+    float eyeHeight = 0.f;
+    float attenuationDist = 0.f;
+
+    unsigned rays = 0;
+    float deltaAngle = 0.f;
+    float columnWidth = 0.f;
+
+    bool fishEyeCorrection = false;
+    bool tileLighting = true;
+    bool mipmapping = true;
+
+    bool rebuildIfNeeded(const Configuration& config);
+
+  private:
+    Configuration m_source{};
+    bool m_valid = false;
+  };
+}
+
+#endif //NULLP0INT_RENDERCAMERA_H
@@ -0,0 +1,169 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <utility>
+
+#include "../../../constants.h"
+
+namespace ecs
+{
+  void RenderQueue::clear()
+  {
+    if (m_params.capacity() < MAX_ITEMS_TO_RENDER)
+    {
+      m_params.reserve(MAX_ITEMS_TO_RENDER);
+      m_entries.reserve(MAX_ITEMS_TO_RENDER);
+      m_scratch.reserve(MAX_ITEMS_TO_RENDER);
+    }
+
+    m_params.clear();
+    m_entries.clear();
+  }
+
+  void RenderQueue::push(const float depth, const RenderItemType type, const RenderDrawParams& params)
+  {
+    if (!params.texture) return;
+
+    const auto index = static_cast<std::uint32_t>(m_params.size());
+    m_params.push_back(params);
+    m_entries.push_back(SortEntry{makeKey(depth, textureSlot(params.texture), type), index});
+  }
+
+  void RenderQueue::push(
+    const float depth,
+    const RenderItemType type,
+    const sf::Texture& texture,
+    const sf::Vector2f position,
+    const sf::Vector2f scale,
+    const sf::Color color
+  )
+  {
+    const sf::Vector2u size = texture.getSize();
+
+    RenderDrawParams p;
+    p.texture = &texture;
+    p.textureRect = sf::IntRect(0, 0, static_cast<int>(size.x), static_cast<int>(size.y));
+    p.position = position;
+    p.scale = scale;
+    p.color = color;
+    push(depth, type, p);
+  }
+
+  std::uint16_t RenderQueue::textureSlot(const sf::Texture* texture)
+  {
+    if (texture == m_lastTexture) return m_lastSlot;
+
+    auto it = m_textureSlots.find(texture);
+    if (it == m_textureSlots.end())
+    {
+      const auto next = static_cast<std::uint16_t>(std::min<std::size_t>(m_textureSlots.size(), 0xFFFFu));
+      it = m_textureSlots.emplace(texture, next).first;
+    }
+
+    m_lastTexture = texture;
+    m_lastSlot = it->second;
+    return m_lastSlot;
+  }
+
+  std::uint64_t RenderQueue::makeKey(const float depth, const std::uint16_t textureSlot, const RenderItemType type)
+  {
+    // [63:32] inverted depth (far first), [31:16] texture slot, [15:8] item type
+    const float d = (depth > 0.f) ? depth : 0.f;
+    const std::uint32_t depthBits = ~std::bit_cast<std::uint32_t>(d);
+
+    return (static_cast<std::uint64_t>(depthBits) << 32)
+      | (static_cast<std::uint64_t>(textureSlot) << 16)
+      | (static_cast<std::uint64_t>(type) << 8);
+  }
+
+  void RenderQueue::sort()
+  {
+    const std::size_t n = m_entries.size();
+    if (n < 2) return;
+
+    m_scratch.resize(n);
+
+    std::uint64_t allOr = 0;
+    std::uint64_t allAnd = ~0ull;
+    for (const auto& e : m_entries)
+    {
+      allOr |= e.key;
+      allAnd &= e.key;
+    }
+    const std::uint64_t varyingBits = allOr ^ allAnd;
+
+    std::array<std::size_t, 256> counts{};
+    for (int shift = 8; shift < 64; shift += 8)
+    {
+      if (((varyingBits >> shift) & 0xFFu) == 0) continue;
+
+      counts.fill(0);
+      for (const auto& e : m_entries)
+      {
+        ++counts[(e.key >> shift) & 0xFFu];
+      }
+
+      std::size_t offset = 0;
+      for (auto& c : counts)
+      {
+        const std::size_t cnt = c;
+        c = offset;
+        offset += cnt;
+      }
+
+      for (const auto& e : m_entries)
+      {
+        m_scratch[counts[(e.key >> shift) & 0xFFu]++] = e;
+      }
+
+      std::swap(m_entries, m_scratch);
+    }
+  }
+
+  void RenderQueue::appendQuad(const RenderDrawParams& p)
+  {
+    const auto& r = p.textureRect;
+    const float w = static_cast<float>(r.width) * p.scale.x;
+    const float h = static_cast<float>(r.height) * p.scale.y;
+
+    const float left = static_cast<float>(r.left);
+    const float top = static_cast<float>(r.top);
+    const float right = left + static_cast<float>(r.width);
+    const float bottom = top + static_cast<float>(r.height);
+
+    m_vertices.append(sf::Vertex({p.position.x, p.position.y}, p.color, {left, top}));
+    m_vertices.append(sf::Vertex({p.position.x + w, p.position.y}, p.color, {right, top}));
+    m_vertices.append(sf::Vertex({p.position.x + w, p.position.y + h}, p.color, {right, bottom}));
+    m_vertices.append(sf::Vertex({p.position.x, p.position.y + h}, p.color, {left, bottom}));
+  }
+
+  void RenderQueue::draw(sf::RenderTarget& target)
+  {
+    m_vertices.clear();
+
+    const sf::Texture* batchTexture = nullptr;
+    for (const auto& e : m_entries)
+    {
+      const RenderDrawParams& p = m_params[e.index];
+      if (p.texture != batchTexture && m_vertices.getVertexCount() > 0)
+      {
+        target.draw(m_vertices, sf::RenderStates(batchTexture));
+        m_vertices.clear();
+      }
+
+      batchTexture = p.texture;
+      appendQuad(p);
+    }
+
+    if (m_vertices.getVertexCount() > 0)
+    {
+      target.draw(m_vertices, sf::RenderStates(batchTexture));
+    }
+  }
+}
@@ -0,0 +1,72 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_RENDERQUEUE_H
+#define NULLP0INT_RENDERQUEUE_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace ecs
+{
+  enum class RenderItemType : std::uint8_t
+  {
+    WALL,
+    ENEMY,
+    PROJECTILE,
+  };
+
+  struct RenderDrawParams
+  {
+    const sf::Texture* texture = nullptr;
+    sf::IntRect textureRect{};
+    sf::Vector2f position{};
+    sf::Vector2f scale{1.f, 1.f};
+    sf::Color color{255, 255, 255};
+  };
+
+  class RenderQueue
+  {
+  public:
+    void clear();
+    void push(float depth, RenderItemType type, const RenderDrawParams& params);
+    void push(float depth, RenderItemType type, const sf::Texture& texture, sf::Vector2f position, sf::Vector2f scale, sf::Color color);
+    void sort();
+    void draw(sf::RenderTarget& target);
+
+    [[nodiscard]] std::size_t size() const { return m_params.size(); }
+
+  private:
+    struct SortEntry
+    {
+      std::uint64_t key = 0;
+      std::uint32_t index = 0;
+    };
+
+    [[nodiscard]] std::uint16_t textureSlot(const sf::Texture* texture);
+    [[nodiscard]] static std::uint64_t makeKey(float depth, std::uint16_t textureSlot, RenderItemType type);
+
+    void appendQuad(const RenderDrawParams& p);
+
+    std::vector<RenderDrawParams> m_params;
+    std::vector<SortEntry> m_entries;
+    std::vector<SortEntry> m_scratch;
+
+    std::unordered_map<const sf::Texture*, std::uint16_t> m_textureSlots;
+    const sf::Texture* m_lastTexture = nullptr;
+    std::uint16_t m_lastSlot = 0;
+
+    sf::VertexArray m_vertices{sf::Quads};
+  };
+}
+
+#endif //NULLP0INT_RENDERQUEUE_H
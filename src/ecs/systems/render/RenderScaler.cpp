@@ -0,0 +1,83 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "RenderScaler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../../constants.h"
+
+namespace ecs
+{
+  bool RenderScaler::ensureTargets(const sf::Vector2u windowSize, const float scale, const UpscaleFilter filter)
+  {
+    const sf::Vector2u size{
+      std::max(1u, static_cast<unsigned>(std::lround(static_cast<float>(windowSize.x) * scale))),
+      std::max(1u, static_cast<unsigned>(std::lround(static_cast<float>(windowSize.y) * scale)))
+    };
+
+    const unsigned factor = (filter == UpscaleFilter::SHARP_BILINEAR)
+      ? std::max(1u, std::min(windowSize.x / size.x, windowSize.y / size.y))
+      : 1u;
+
+    if (size == m_internalSize && factor == m_prescaleFactor && filter == m_filter) return true;
+
+    if (!m_scene.create(size.x, size.y)) return false;
+    m_scene.setSmooth(filter == UpscaleFilter::SHARP_BILINEAR && factor == 1u);
+    m_scene.setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT))));
+
+    if (factor > 1u)
+    {
+      if (!m_prescaled.create(size.x * factor, size.y * factor)) return false;
+      m_prescaled.setSmooth(true);
+    }
+
+    m_internalSize = size;
+    m_prescaleFactor = factor;
+    m_filter = filter;
+    return true;
+  }
+
+  sf::RenderTarget& RenderScaler::begin(sf::RenderWindow& window, const sf::Vector2u windowSize, const Configuration& config)
+  {
+    const float scale = std::clamp(config.render_scale, MIN_RENDER_SCALE, 1.f);
+    m_active = scale < 1.f && ensureTargets(windowSize, scale, config.upscale_filter);
+    if (!m_active) return window;
+
+    m_scene.clear(sf::Color::Black);
+    return m_scene;
+  }
+
+  void RenderScaler::present(sf::RenderWindow& window, const sf::Vector2u windowSize)
+  {
+    if (!m_active) return;
+    m_scene.display();
+
+    const sf::Texture* source = &m_scene.getTexture();
+    sf::Vector2f sourceSize{static_cast<float>(m_internalSize.x), static_cast<float>(m_internalSize.y)};
+
+    if (m_prescaleFactor > 1u)
+    {
+      m_sprite.setTexture(*source, true);
+      m_sprite.setScale(static_cast<float>(m_prescaleFactor), static_cast<float>(m_prescaleFactor));
+      m_prescaled.setView(m_prescaled.getDefaultView());
+      m_prescaled.draw(m_sprite);
+      m_prescaled.display();
+
+      source = &m_prescaled.getTexture();
+      sourceSize *= static_cast<float>(m_prescaleFactor);
+    }
+
+    const sf::View previous = window.getView();
+    const sf::Vector2f size{static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)};
+    window.setView(sf::View(sf::FloatRect({0.f, 0.f}, size)));
+
+    m_sprite.setTexture(*source, true);
+    m_sprite.setScale(size.x / sourceSize.x, size.y / sourceSize.y);
+    window.draw(m_sprite);
+
+    window.setView(previous);
+  }
+}
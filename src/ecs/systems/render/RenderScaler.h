@@ -0,0 +1,39 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_RENDERSCALER_H
+#define NULLP0INT_RENDERSCALER_H
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include "../../../configuration/Configuration.h"
+
+namespace ecs
+{
+  class RenderScaler
+  {
+  public:
+    sf::RenderTarget& begin(sf::RenderWindow& window, sf::Vector2u windowSize, const Configuration& config);
+    void present(sf::RenderWindow& window, sf::Vector2u windowSize);
+
+    [[nodiscard]] sf::Vector2u internalSize() const { return m_internalSize; }
+
+  private:
+    sf::RenderTexture m_scene;
+    sf::RenderTexture m_prescaled;
+    sf::Sprite m_sprite;
+
+    sf::Vector2u m_internalSize{0u, 0u};
+    unsigned m_prescaleFactor = 1u;
+    UpscaleFilter m_filter = UpscaleFilter::NEAREST;
+    bool m_active = false;
+
+    bool ensureTargets(sf::Vector2u windowSize, float scale, UpscaleFilter filter);
+  };
+}
+
+#endif //NULLP0INT_RENDERSCALER_H
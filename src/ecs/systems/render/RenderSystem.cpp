@@ -17,344 +17,260 @@
 
 using namespace ecs;
 
-void RenderSystem::render(Registry &registry, const Configuration &config, sf::RenderWindow &window, const Entity &m_tilemap, const float globalTime, const TextureManager &textureManager)
+namespace
 {
-  const sf::Color ceilingColor(4, 2, 115);
-  sf::RectangleShape ceiling(sf::Vector2f(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT) / 2.f));
-  ceiling.setPosition(0.f, 0.f);
-  ceiling.setFillColor(ceilingColor);
-  window.draw(ceiling);
-
-  if (const auto* tilemapComp = registry.getComponent<TilemapComponent>(m_tilemap); !tilemapComp)
+  [[nodiscard]] const sf::Texture* selectSpriteMip(const TextureManager& textureManager, const std::string& id, const sf::Texture& base, const float projectedHeight)
   {
-    return;
-  }
+    const float texelsPerPixel = static_cast<float>(std::max(1u, base.getSize().y)) / std::max(1.f, projectedHeight);
+    const int mip = TextureManager::selectMipLevel(texelsPerPixel);
+    if (mip == 0) return &base;
 
-  Entity playerEntity = INVALID_ENTITY;
-  for (const auto& e : registry.entities())
-  {
-    if (registry.hasComponent<PlayerTag>(e))
-    {
-      playerEntity = e;
-      break;
-    }
+    const sf::Texture* mipTex = textureManager.get(id, mip);
+    return mipTex ? mipTex : &base;
   }
-  if (playerEntity == INVALID_ENTITY) return;
-
-  const auto* posComp = registry.getComponent<PositionComponent>(playerEntity);
-  const auto* rotComp = registry.getComponent<RotationComponent>(playerEntity);
-  const auto* rayResults = registry.getComponent<RayCastResultComponent>(playerEntity);
-
-  if (!posComp || !rotComp || !rayResults) return;
-
-  renderFloor(registry, config, window, m_tilemap, rotComp->angle, posComp->position, textureManager);
-
-  std::vector<RenderItem> items;
-  items.reserve(MAX_ITEMS_TO_RENDER);
-
-  renderWalls(registry, config, m_tilemap, rotComp->angle, *rayResults, globalTime, textureManager, items);
-  renderEnemies(registry, config, textureManager, items);
-  renderProjectiles(registry, config, textureManager, items);
 
-  std::ranges::sort(
-    items, [](const RenderItem& a, const RenderItem& b){
-    return a.depth > b.depth;
-  });
-  for (const auto &it : items)
+  [[nodiscard]] bool isCentreColumnClear(const RayCastResultComponent& rayResults, const sf::Vector2f eye, const double viewAngleRad, const float halfFov, const float deltaAngle, const sf::Vector2f point)
   {
-    window.draw(it.sprite);
-  }
-}
-
+    const float dx = point.x - eye.x;
+    const float dy = point.y - eye.y;
+    const float dist = std::hypot(dx, dy);
+    if (!std::isfinite(dist) || dist <= 0.f) return false;
 
-void RenderSystem::renderFloor(Registry &registry, Configuration config, sf::RenderWindow &window, const Entity& m_tilemap, float playerRotationAngle, const sf::Vector2f playerPos, const TextureManager& textureManager)
-{
-  auto* tilemapComp = registry.getComponent<TilemapComponent>(m_tilemap);
-  if (!tilemapComp) return;
+    double delta = std::atan2(static_cast<double>(dy), static_cast<double>(dx)) - viewAngleRad;
+    while (delta > M_PI) delta -= 2.0 * M_PI;
+    while (delta < -M_PI) delta += 2.0 * M_PI;
+    if (std::abs(delta) > static_cast<double>(halfFov)) return false;
 
-  const std::string floorTexId = tilemapComp->floorTextureId;
-  const sf::Texture* floorTex = nullptr;
-  if (!floorTexId.empty())
-  {
-    floorTex = textureManager.get(floorTexId);
+    const int rays = static_cast<int>(rayResults.hits.size());
+    const int centreColumn = std::clamp(static_cast<int>(std::floor((delta + static_cast<double>(halfFov)) / static_cast<double>(deltaAngle))), 0, rays - 1);
+    const float wallDist = rayResults.hits[centreColumn].distance;
+    return std::isfinite(wallDist) && dist + SMALL_EPSILON < wallDist;
   }
 
-  if (!floorTex)
+  struct WallPassInput
   {
-    const sf::Color floorColor(50, 50, 50);
-    sf::RectangleShape floorBg(sf::Vector2f(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT) / 2.f));
-    floorBg.setPosition(0.f, static_cast<float>(SCREEN_HEIGHT) / 2.f);
-    floorBg.setFillColor(floorColor);
-    window.draw(floorBg);
-    return;
-  }
-
-  const auto fov = config.fov;
-  const auto half_fov = fov / 2.f;
-  const auto player_eye_height = config.player_eye_height;
-  const auto max_linear_attenuation_distance = config.attenuation_distance;
-  const auto tile_size = config.tile_size;
-
-  const float screenDist = HALF_SCREEN_WIDTH / std::tan(half_fov);
-
-  const float ang = radiansFromDegrees(playerRotationAngle);
-  const float leftAngle = ang - half_fov;
-  const float rightAngle = ang + half_fov;
+    const TilemapComponent& map;
+    const RenderCamera& camera;
+    float viewAngle;
+    const RayCastResultComponent& rayResults;
+    const TileTextureTable& tileTextures;
+    const TextureManager& textureManager;
+    const LightTable& lights;
+    const TileLightGrid& lightGrid;
+    RenderQueue& queue;
+  };
+
+  template <bool FishEyeCorrection, bool TileLighting, bool Mipmapping>
+  void wallPass(const WallPassInput& in)
+  {
+    const RenderCamera& camera = in.camera;
+    const TilemapComponent& map = in.map;
+    const float screenDist = camera.screenDist;
+    const float columnWidth = camera.columnWidth;
+    const float tileSize = camera.tileSize;
 
-  const sf::Vector2f dirLeft{ std::cos(leftAngle), std::sin(leftAngle) };
-  const sf::Vector2f dirRight{ std::cos(rightAngle), std::sin(rightAngle) };
+    const sf::Texture* placeholder = in.textureManager.get("placeholder");
 
-  const float texW = static_cast<float>(floorTex->getSize().x);
-  const float texH = static_cast<float>(floorTex->getSize().y);
+    const unsigned count = std::min(camera.rays, static_cast<unsigned>(in.rayResults.hits.size()));
+    for (unsigned i = 0; i < count; ++i)
+    {
+      const RayHit& hit = in.rayResults.hits[i];
+      if (hit.distance <= 0.f || !std::isfinite(hit.distance)) continue;
 
-  sf::RenderStates states;
-  states.texture = floorTex;
+      const float rayA = hit.rayAngle;
 
+      float correctedDepth = hit.distance;
+      if constexpr (FishEyeCorrection)
+      {
+        correctedDepth *= std::cos(in.viewAngle - rayA);
+      }
 
-  constexpr int ROW_START = HALF_SCREEN_HEIGHT;
-  constexpr int ROW_END   = SCREEN_HEIGHT - 1;
-  constexpr int ROW_STEP  = 1;
+      sf::Color tint;
+      if constexpr (TileLighting)
+      {
+        tint = in.lights.tint(correctedDepth, in.lightGrid.faceLight(hit), LightTable::MIN_WALL_LIGHT);
+      }
+      else
+      {
+        tint = in.lights.tint(correctedDepth, LightTable::MIN_WALL_LIGHT);
+      }
 
-  constexpr int rowsCount = ((ROW_END - ROW_START) / ROW_STEP) + 1;
+      const float projHeight = screenDist * tileSize / (correctedDepth + BIG_EPSILON);
+      const float h = std::min(projHeight, static_cast<float>(SCREEN_HEIGHT) * 2.f);
+      const float columnX = static_cast<float>(i) * columnWidth;
+      const float columnY = HALF_SCREEN_HEIGHT - (h / 2.f);
 
-  sf::VertexArray va(sf::Quads);
-  va.resize(static_cast<std::size_t>(rowsCount) * 4);
+      auto pushPlaceholder = [&]
+      {
+        if (placeholder)
+        {
+          in.queue.push(correctedDepth, RenderItemType::WALL, *placeholder, {columnX, columnY}, {columnWidth, h}, tint);
+        }
+      };
 
-  int vaIndex = 0;
-  for (int y = ROW_START; y <= ROW_END; y += ROW_STEP)
-  {
-    float p = static_cast<float>(y) - HALF_SCREEN_HEIGHT;
-    if (std::abs(p) < SMALL_EPSILON)
-    {
-      p = SMALL_EPSILON;
-    }
+      if (hit.tileX < 0 || hit.tileY < 0 ||
+          hit.tileX >= static_cast<int>(map.width) ||
+          hit.tileY >= static_cast<int>(map.height))
+      {
+        pushPlaceholder();
+        continue;
+      }
 
-    float rowDistance = (player_eye_height * screenDist) / p;
-    if (!std::isfinite(rowDistance)) continue;
-    if (const float maxRowDist = tile_size * max_linear_attenuation_distance * 2.f; rowDistance > maxRowDist) rowDistance = maxRowDist;
+      const TileTextureTable::Entry& resolved = in.tileTextures[map.tiles[hit.tileY][hit.tileX]];
+      const sf::Texture* tex = resolved.texture;
+      if (!tex)
+      {
+        pushPlaceholder();
+        continue;
+      }
 
-    const sf::Vector2f floorPointLeft  = playerPos + dirLeft  * rowDistance;
-    const sf::Vector2f floorPointRight = playerPos + dirRight * rowDistance;
+      float u;
+      if (hit.vertical)
+      {
+        const float hitYTiles = hit.hitPointWorld.y / tileSize;
+        float frac = hitYTiles - std::floor(hitYTiles);
+        if (frac < 0.f) frac += 1.f;
+        u = std::cos(rayA) > 0.f ? frac : (1.f - frac);
+      }
+      else
+      {
+        const float hitXTiles = hit.hitPointWorld.x / tileSize;
+        float frac = hitXTiles - std::floor(hitXTiles);
+        if (frac < 0.f) frac += 1.f;
+        u = std::sin(rayA) > 0.f ? (1.f - frac) : frac;
+      }
 
-    float uLeft  = (floorPointLeft.x  / tile_size) * texW;
-    float vLeft  = (floorPointLeft.y  / tile_size) * texH;
-    float uRight = (floorPointRight.x / tile_size) * texW;
-    float vRight = (floorPointRight.y / tile_size) * texH;
+      const float projTileWidth = projHeight;
+      if constexpr (Mipmapping)
+      {
+        if (const int mip = TextureManager::selectMipLevel(static_cast<float>(tex->getSize().x) / (projTileWidth + BIG_EPSILON)); mip > 0)
+        {
+          if (const sf::Texture* mipTex = in.textureManager.get(*resolved.textureId, mip)) tex = mipTex;
+        }
+      }
 
-    if (std::abs(uLeft) > texW * SAFE_REPEAT_BEFORE_NORMALIZATION)  uLeft  = std::fmod(uLeft,  texW);
-    if (std::abs(uRight) > texW * SAFE_REPEAT_BEFORE_NORMALIZATION) uRight = std::fmod(uRight, texW);
-    if (std::abs(vLeft) > texH * SAFE_REPEAT_BEFORE_NORMALIZATION)  vLeft  = std::fmod(vLeft,  texH);
-    if (std::abs(vRight) > texH * SAFE_REPEAT_BEFORE_NORMALIZATION) vRight = std::fmod(vRight, texH);
+      const int texWidth = static_cast<int>(tex->getSize().x);
+      const int texHeight = static_cast<int>(tex->getSize().y);
+      if (texWidth <= 0 || texHeight <= 0)
+      {
+        pushPlaceholder();
+        continue;
+      }
 
-    float brightnessFactor = 1.f - std::min(rowDistance / (tile_size * max_linear_attenuation_distance), 1.f);
-    uint8_t bright = static_cast<uint8_t>(std::clamp(brightnessFactor * 255.f, 30.f, 255.f));
-    sf::Color rowColor(bright, bright, bright);
+      int sampleCenter = static_cast<int>(std::floor(u * static_cast<float>(texWidth) + 0.0001f)) % texWidth;
+      if (sampleCenter < 0) sampleCenter += texWidth;
 
-    va[vaIndex + 0].position = sf::Vector2f(0.f, static_cast<float>(y));
-    va[vaIndex + 0].texCoords = sf::Vector2f(uLeft, vLeft);
-    va[vaIndex + 0].color = rowColor;
+      const float texelsPerPixel = texWidth / (projTileWidth + BIG_EPSILON);
+      const int sourceWidth = std::min(texWidth, std::max(1, static_cast<int>(std::round(texelsPerPixel * columnWidth))));
 
-    va[vaIndex + 1].position = sf::Vector2f(static_cast<float>(SCREEN_WIDTH), static_cast<float>(y));
-    va[vaIndex + 1].texCoords = sf::Vector2f(uRight, vRight);
-    va[vaIndex + 1].color = rowColor;
+      int sx = sampleCenter - sourceWidth / 2;
+      sx = std::clamp(sx, 0, texWidth - sourceWidth);
 
-    float yBottom = static_cast<float>(std::min(y + ROW_STEP, ROW_END));
-    va[vaIndex + 2].position = sf::Vector2f(static_cast<float>(SCREEN_WIDTH), yBottom);
-    va[vaIndex + 2].texCoords = sf::Vector2f(uRight, vRight);
-    va[vaIndex + 2].color = rowColor;
+      const sf::IntRect rect(sx, 0, sourceWidth, texHeight);
 
-    va[vaIndex + 3].position = sf::Vector2f(0.f, yBottom);
-    va[vaIndex + 3].texCoords = sf::Vector2f(uLeft, vLeft);
-    va[vaIndex + 3].color = rowColor;
+      const float scaleX = columnWidth / static_cast<float>(rect.width);
+      const float scaleY = h / static_cast<float>(rect.height);
 
-    vaIndex += 4;
+      in.queue.push(correctedDepth, RenderItemType::WALL, RenderDrawParams{tex, rect, {columnX, columnY}, {scaleX, scaleY}, tint});
+    }
   }
-
-  window.draw(va, states);
 }
 
-
-void RenderSystem::renderWalls(Registry &registry, Configuration config, const Entity& tilemapEntity, float playerAngle, const RayCastResultComponent& rayResults, float globalTime, const TextureManager& textureManager, std::vector<RenderItem>& items)
+void RenderSystem::render(Registry &registry, const Configuration &config, sf::RenderTarget &window, const Entity &m_tilemap, const float globalTime, const TextureManager &textureManager)
 {
-  auto* tilemapComp = registry.getComponent<TilemapComponent>(tilemapEntity);
-  if (!tilemapComp || rayResults.hits.empty()) return;
-
-  const auto amount_of_rays = static_cast<unsigned>(config.resolution_option);
-  const auto fov = config.fov;
-  const auto halfFov = fov / 2.f;
-  const auto deltaAngle = fov / static_cast<float>(amount_of_rays);
-  const auto maxAttenuationDist = config.attenuation_distance * config.tile_size;
-  const bool fishEyeCorrection = config.enable_fish_eye;
-
-  const float screenDist = HALF_SCREEN_WIDTH / std::tan(halfFov);
-  const float columnWidth = static_cast<float>(SCREEN_WIDTH) / static_cast<float>(amount_of_rays);
-  const float ang = radiansFromDegrees(playerAngle);
-  float rayAngle = ang - halfFov;
-
-  std::unordered_map<std::string, const sf::Texture*> textureCache;
+  const auto* tilemapComp = registry.getComponent<TilemapComponent>(m_tilemap);
+  if (!tilemapComp)
+  {
+    return;
+  }
 
-  for (unsigned i = 0; i < amount_of_rays && i < rayResults.hits.size(); ++i)
+  Entity playerEntity = INVALID_ENTITY;
+  for (const auto& e : registry.entities())
   {
-    const RayHit& hit = rayResults.hits[i];
-    if (hit.distance <= 0.f || !std::isfinite(hit.distance))
+    if (registry.hasComponent<PlayerTag>(e))
     {
-      rayAngle += deltaAngle;
-      continue;
+      playerEntity = e;
+      break;
     }
+  }
+  if (playerEntity == INVALID_ENTITY) return;
 
-    const float rayA = hit.rayAngle;
+  const auto* posComp = registry.getComponent<PositionComponent>(playerEntity);
+  const auto* rotComp = registry.getComponent<RotationComponent>(playerEntity);
+  const auto* rayResults = registry.getComponent<RayCastResultComponent>(playerEntity);
 
-    float correctedDepth = hit.distance;
-    if (fishEyeCorrection)
-    {
-      correctedDepth *= std::cos(ang - rayA);
-    }
+  if (!posComp || !rotComp || !rayResults) return;
 
-    const float projHeight = screenDist * config.tile_size / (correctedDepth + BIG_EPSILON);
-    const float h = std::min(projHeight, static_cast<float>(SCREEN_HEIGHT) * 2.f);
-    const float columnX = static_cast<float>(i) * columnWidth;
-    const float columnY = HALF_SCREEN_HEIGHT - (h / 2.f);
+  m_camera.rebuildIfNeeded(config);
+  m_lights.rebuildIfNeeded(config);
 
-    if (hit.tileX < 0 || hit.tileY < 0 ||
-        hit.tileX >= static_cast<int>(tilemapComp->width) ||
-        hit.tileY >= static_cast<int>(tilemapComp->height))
-    {
-      if (const sf::Texture* solidTex = textureManager.get("placeholder"))
-      {
-        sf::Sprite sprite(*solidTex);
-        sprite.setScale(columnWidth, h);
-        sprite.setPosition(columnX, columnY);
-        float brightness = 1.f - std::min(correctedDepth / maxAttenuationDist, 1.f);
-        uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
-        RenderItem it; it.depth = correctedDepth; it.sprite = sprite;
-        items.push_back(std::move(it));
-      }
-      rayAngle += deltaAngle;
-      continue;
-    }
+  if (m_camera.tileLighting) m_lightGrid.build(registry, *tilemapComp);
 
-    const char tileChar = tilemapComp->tiles[hit.tileY][hit.tileX];
-    auto appIt = tilemapComp->tileAppearanceMap.find(tileChar);
-
-    if (appIt == tilemapComp->tileAppearanceMap.end())
-    {
-      if (const sf::Texture* solidTex = textureManager.get("placeholder"))
-      {
-        sf::Sprite sprite(*solidTex);
-        sprite.setScale(columnWidth, h);
-        sprite.setPosition(columnX, columnY);
-        float brightness = 1.f - std::min(correctedDepth / maxAttenuationDist, 1.f);
-        uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
-        RenderItem it; it.depth = correctedDepth; it.sprite = sprite;
-        items.push_back(std::move(it));
-      }
-      rayAngle += deltaAngle;
-      continue;
-    }
+  renderFloor(registry, m_camera, window, m_tilemap, rotComp->angle, posComp->position, textureManager, m_lights, m_lightGrid);
 
-    const TileAppearance& appearance = appIt->second;
-    const std::string& texId = appearance.isAnimated() ?
-                              appearance.currentTextureId(globalTime) :
-                              appearance.singleTextureId;
+  m_queue.clear();
 
-    if (texId.empty())
-    {
-      if (const sf::Texture* solidTex = textureManager.get("placeholder"))
-      {
-        sf::Sprite sprite(*solidTex);
-        sprite.setScale(columnWidth, h);
-        sprite.setPosition(columnX, columnY);
-        float brightness = 1.f - std::min(correctedDepth / maxAttenuationDist, 1.f);
-        uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
-        RenderItem it; it.depth = correctedDepth; it.sprite = sprite;
-        items.push_back(std::move(it));
-      }
-      rayAngle += deltaAngle;
-      continue;
-    }
+  renderWalls(registry, m_camera, m_tilemap, rotComp->angle, *rayResults, globalTime, textureManager, m_lights, m_lightGrid, m_queue);
+  renderEnemies(registry, m_camera, textureManager, m_lights, m_lightGrid, m_queue);
+  renderProjectiles(registry, m_camera, textureManager, m_lights, m_lightGrid, m_queue);
 
-    const sf::Texture* tex = nullptr;
-    if (auto cacheIt = textureCache.find(texId); cacheIt != textureCache.end()) {
-      tex = cacheIt->second;
-    } else {
-      tex = textureManager.get(texId);
-      textureCache[texId] = tex;
-    }
+  m_queue.sort();
+  m_queue.draw(window);
+}
 
-    if (!tex)
-    {
-      if (const sf::Texture* solidTex = textureManager.get("placeholder"))
-      {
-        sf::Sprite sprite(*solidTex);
-        sprite.setScale(columnWidth, h);
-        sprite.setPosition(columnX, columnY);
-        float brightness = 1.f - std::min(correctedDepth / maxAttenuationDist, 1.f);
-        uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
-        RenderItem it; it.depth = correctedDepth; it.sprite = sprite;
-        items.push_back(std::move(it));
-      }
-      rayAngle += deltaAngle;
-      continue;
-    }
 
-    float u;
-    {
-      const float tileSizeF = config.tile_size;
-      if (hit.vertical)
-      {
-        const float hitYTiles = hit.hitPointWorld.y / tileSizeF;
-        float frac = hitYTiles - std::floor(hitYTiles);
-        if (frac < 0.f) frac += 1.f;
-        u = std::cos(rayA) > 0.f ? frac : (1.f - frac);
-      }
-      else
-      {
-        const float hitXTiles = hit.hitPointWorld.x / tileSizeF;
-        float frac = hitXTiles - std::floor(hitXTiles);
-        if (frac < 0.f) frac += 1.f;
-        u = std::sin(rayA) > 0.f ? (1.f - frac) : frac;
-      }
-    }
+void RenderSystem::renderFloor(Registry &registry, const RenderCamera &camera, sf::RenderTarget &window, const Entity& m_tilemap, const float playerRotationAngle, const sf::Vector2f playerPos, const TextureManager& textureManager, const LightTable& lights, const TileLightGrid& lightGrid)
+{
+  const auto* tilemapComp = registry.getComponent<TilemapComponent>(m_tilemap);
+  if (!tilemapComp) return;
 
-    const int texWidth = static_cast<int>(tex->getSize().x);
-    const int texHeight = static_cast<int>(tex->getSize().y);
+  const bool hasTextures =
+    textureManager.getImage(tilemapComp->floorTextureId) ||
+    !tilemapComp->floorTexturePalette.empty() ||
+    textureManager.getImage(tilemapComp->ceilingTextureId);
 
-    int sampleCenter = static_cast<int>(std::floor(u * static_cast<float>(texWidth) + 0.0001f)) % texWidth;
-    if (sampleCenter < 0) sampleCenter += texWidth;
+  if (!hasTextures)
+  {
+    const sf::Color ceilingColor(4, 2, 115);
+    sf::RectangleShape ceiling(sf::Vector2f(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT) / 2.f));
+    ceiling.setPosition(0.f, 0.f);
+    ceiling.setFillColor(ceilingColor);
+    window.draw(ceiling);
 
-    const float projTileWidth = screenDist * config.tile_size / (correctedDepth + BIG_EPSILON);
-    const float texelsPerPixel = texWidth / (projTileWidth + BIG_EPSILON);
-    const int sourceWidth = std::max(1, static_cast<int>(std::round(texelsPerPixel * columnWidth)));
+    const sf::Color floorColor(50, 50, 50);
+    sf::RectangleShape floorBg(sf::Vector2f(static_cast<float>(SCREEN_WIDTH), static_cast<float>(SCREEN_HEIGHT) / 2.f));
+    floorBg.setPosition(0.f, static_cast<float>(SCREEN_HEIGHT) / 2.f);
+    floorBg.setFillColor(floorColor);
+    window.draw(floorBg);
+    return;
+  }
 
-    int sx = sampleCenter - sourceWidth / 2;
-    sx = std::clamp(sx, 0, texWidth - sourceWidth);
+  m_caster.render(window, *tilemapComp, camera, textureManager, lights, lightGrid, playerPos, playerRotationAngle);
+}
 
-    sf::IntRect rect(sx, 0, sourceWidth, texHeight);
-    sf::Sprite sprite(*tex, rect);
 
-    const float scaleX = columnWidth / static_cast<float>(rect.width);
-    const float scaleY = h / static_cast<float>(rect.height);
-    sprite.setScale(scaleX, scaleY);
-    sprite.setPosition(columnX, columnY);
+void RenderSystem::renderWalls(Registry &registry, const RenderCamera &camera, const Entity& tilemapEntity, const float playerAngle, const RayCastResultComponent& rayResults, const float globalTime, const TextureManager& textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue)
+{
+  const auto* tilemapComp = registry.getComponent<TilemapComponent>(tilemapEntity);
+  if (!tilemapComp || rayResults.hits.empty()) return;
 
-    const float brightness = 1.f - std::min(correctedDepth / maxAttenuationDist, 1.f);
-    const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-    sprite.setColor(sf::Color(bright, bright, bright));
+  using WallPass = void (*)(const WallPassInput&);
+  static constexpr WallPass passes[8] = {
+    &wallPass<false, false, false>, &wallPass<false, false, true>,
+    &wallPass<false, true, false>,  &wallPass<false, true, true>,
+    &wallPass<true, false, false>,  &wallPass<true, false, true>,
+    &wallPass<true, true, false>,   &wallPass<true, true, true>,
+  };
 
-    RenderItem it;
-    it.depth = correctedDepth;
-    it.sprite = sprite;
-    items.push_back(std::move(it));
+  m_tileTextures.rebuild(*tilemapComp, textureManager, globalTime);
 
-    rayAngle += deltaAngle;
-  }
+  const WallPassInput input{*tilemapComp, camera, radiansFromDegrees(playerAngle), rayResults, m_tileTextures, textureManager, lights, lightGrid, queue};
+  const std::size_t variant =
+    (camera.fishEyeCorrection ? 4u : 0u) | (camera.tileLighting ? 2u : 0u) | (camera.mipmapping ? 1u : 0u);
+  passes[variant](input);
 }
 
-void RenderSystem::drawSolidColumn(sf::RenderWindow &window, const float x, const  float y, const float width, const float height, const float depth, const float maxAttenuationDist)
+void RenderSystem::drawSolidColumn(sf::RenderTarget &window, const float x, const  float y, const float width, const float height, const float depth, const float maxAttenuationDist)
 {
   const float brightness = 1.f - std::min(depth / maxAttenuationDist, 1.f);
   const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
@@ -365,7 +281,7 @@ void RenderSystem::drawSolidColumn(sf::RenderWindow &window, const float x, cons
 }
 
 
-void RenderSystem::renderEnemies(Registry &registry, const Configuration &config, const TextureManager &textureManager, std::vector<RenderItem>& items)
+void RenderSystem::renderEnemies(Registry &registry, const RenderCamera &camera, const TextureManager &textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue)
 {
   Entity player = INVALID_ENTITY;
   for (const auto &e : registry.entities())
@@ -385,13 +301,14 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
   if (rayResults->hits.empty()) return;
 
   const int       amount_of_rays = static_cast<int>(rayResults->hits.size());
-  const float     fov            = config.fov;
-  const float     halfFov        = fov * 0.5f;
-  const float     deltaAngle     = fov / static_cast<float>(amount_of_rays);
+  const float     halfFov        = camera.halfFov;
+  const float     deltaAngle     = camera.fov / static_cast<float>(amount_of_rays);
   constexpr auto  windowW        = static_cast<float>(SCREEN_WIDTH);
   constexpr auto  windowH        = static_cast<float>(SCREEN_HEIGHT);
-  const float     screenDist     = (windowW * 0.5f) / std::tan(halfFov);
+  const float     screenDist     = camera.screenDist;
   const float     columnWidth    = windowW / static_cast<float>(amount_of_rays);
+  const float     cullExtent     = camera.tileSize * 0.5f;
+  const double    playerAngleRad = radiansFromDegrees(rotComp->angle);
 
   struct EnemyEntry { Entity e; float dist; const PositionComponent* pos; const EnemyComponent* comp; };
   std::vector<EnemyEntry> enemies;
@@ -401,6 +318,8 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
     const auto* epos = registry.getComponent<PositionComponent>(ent);
     const auto* enemyComp = registry.getComponent<EnemyComponent>(ent);
     if (!epos || !enemyComp) continue;
+    if (!rayResults->isAreaVisible(epos->position, cullExtent, camera.tileSize)
+        && !isCentreColumnClear(*rayResults, posComp->position, playerAngleRad, halfFov, deltaAngle, epos->position)) continue;
     const float dx = epos->position.x - posComp->position.x;
     const float dy = epos->position.y - posComp->position.y;
     const float enemyDist = std::hypot(dx, dy);
@@ -410,8 +329,6 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
   std::ranges::sort(enemies, [](auto &a, auto &b){ return a.dist > b.dist; });
 
-  const double playerAngleRad = radiansFromDegrees(rotComp->angle);
-
   std::unordered_map<std::string, const sf::Texture*> textureCache;
   for (const auto &entry : enemies)
   {
@@ -438,8 +355,9 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
     const auto normDist = static_cast<float>(enemyDist * std::cos(delta));
     if (normDist <= SMALL_EPSILON) continue;
+    const std::uint8_t tileLight = camera.tileLighting ? lightGrid.atWorld(epos->position) : LIGHTMAP_AMBIENT;
 
-    const float projHeight = screenDist * config.tile_size / (normDist + SMALL_EPSILON);
+    const float projHeight = screenDist * camera.tileSize / (normDist + SMALL_EPSILON);
     const float projWidth = projHeight * 0.75f * enemyComp->spriteScale;
     const float screenX = ((static_cast<float>((delta + halfFov) / deltaAngle)) * columnWidth);
     const float spriteX = screenX - (projWidth * 0.5f);
@@ -456,35 +374,21 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
       if (tex)
       {
-        sf::Sprite sprite(*tex);
+        if (camera.mipmapping) tex = selectSpriteMip(textureManager, frameTexId, *tex, projHeight * enemyComp->spriteScale);
 
         const float texW = static_cast<float>(tex->getSize().x);
         const float texH = static_cast<float>(tex->getSize().y);
 
         const float scaleX = (projWidth / std::max(1.f, texW)) * enemyComp->spriteScale;
         const float scaleY = (projHeight / std::max(1.f, texH)) * enemyComp->spriteScale;
-        sprite.setScale(scaleX, scaleY);
-        sprite.setPosition(spriteX, spriteY);
-
-        const float maxAttenuation = config.attenuation_distance * config.tile_size;
-        const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-        const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
 
-        RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+        queue.push(normDist, RenderItemType::ENEMY, *tex, {spriteX, spriteY}, {scaleX, scaleY}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT));
       }
       else
       {
         if (const sf::Texture* solidTex = textureManager.get("placeholder"))
         {
-          sf::Sprite sprite(*solidTex);
-          sprite.setScale(projWidth, projHeight);
-          sprite.setPosition(spriteX, spriteY);
-          const float maxAttenuation = config.attenuation_distance * config.tile_size;
-          const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-          const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-          sprite.setColor(sf::Color(bright, bright, bright));
-          RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+          queue.push(normDist, RenderItemType::ENEMY, *solidTex, {spriteX, spriteY}, {projWidth, projHeight}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT));
         }
       }
     }
@@ -500,22 +404,17 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
       if (tex)
       {
-        sf::Sprite sprite(*tex, rect);
+        const int mip = camera.mipmapping ? TextureManager::selectMipLevel(static_cast<float>(std::max(1, rect.height)) / std::max(1.f, projHeight * enemyComp->spriteScale)) : 0;
+        const sf::Texture* mipTex = mip > 0 ? textureManager.get(texId, mip) : nullptr;
+        const sf::IntRect mipRect = mipTex ? TextureManager::mipRect(rect, mip) : rect;
+        if (mipTex) tex = mipTex;
 
-        const float rectW = static_cast<float>(std::max(1, rect.width));
-        const float rectH = static_cast<float>(std::max(1, rect.height));
+        const float rectW = static_cast<float>(std::max(1, mipRect.width));
+        const float rectH = static_cast<float>(std::max(1, mipRect.height));
         const float scaleX = (projWidth / rectW) * enemyComp->spriteScale;
         const float scaleY = (projHeight / rectH) * enemyComp->spriteScale;
-        sprite.setScale(scaleX, scaleY);
 
-        sprite.setPosition(spriteX, spriteY);
-
-        const float maxAttenuation = config.attenuation_distance * config.tile_size;
-        const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-        const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-        sprite.setColor(sf::Color(bright, bright, bright));
-
-        RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+        queue.push(normDist, RenderItemType::ENEMY, RenderDrawParams{tex, mipRect, {spriteX, spriteY}, {scaleX, scaleY}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT)});
       }
     }
     else
@@ -529,37 +428,21 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
         if (tex)
         {
-          sf::Sprite sprite;
-          sprite.setTexture(*tex);
+          if (camera.mipmapping) tex = selectSpriteMip(textureManager, texId, *tex, projHeight * enemyComp->spriteScale);
 
           const float texW = static_cast<float>(tex->getSize().x);
           const float texH = static_cast<float>(tex->getSize().y);
 
           const float scaleX = (projWidth / texW) * enemyComp->spriteScale;
           const float scaleY = (projHeight / texH) * enemyComp->spriteScale;
-          sprite.setScale(scaleX, scaleY);
-
-          sprite.setPosition(spriteX, spriteY);
 
-          const float maxAttenuation = config.attenuation_distance * config.tile_size;
-          const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-          const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-          sprite.setColor(sf::Color(bright, bright, bright));
-
-          RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+          queue.push(normDist, RenderItemType::ENEMY, *tex, {spriteX, spriteY}, {scaleX, scaleY}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT));
         }
         else
         {
           if (const sf::Texture* solidTex = textureManager.get("placeholder"))
           {
-            sf::Sprite sprite(*solidTex);
-            sprite.setScale(projWidth, projHeight);
-            sprite.setPosition(spriteX, spriteY);
-            const float maxAttenuation = config.attenuation_distance * config.tile_size;
-            const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-            const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-            sprite.setColor(sf::Color(bright, bright, bright));
-            RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+            queue.push(normDist, RenderItemType::ENEMY, *solidTex, {spriteX, spriteY}, {projWidth, projHeight}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT));
           }
         }
       }
@@ -567,14 +450,7 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
       {
         if (const sf::Texture* solidTex = textureManager.get("placeholder"))
         {
-          sf::Sprite sprite(*solidTex);
-          sprite.setScale(projWidth, projHeight);
-          sprite.setPosition(spriteX, spriteY);
-          const float maxAttenuation = config.attenuation_distance * config.tile_size;
-          const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-          const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 30.f, 255.f));
-          sprite.setColor(sf::Color(bright, bright, bright));
-          RenderItem it; it.depth = normDist; it.sprite = sprite; items.push_back(std::move(it));
+          queue.push(normDist, RenderItemType::ENEMY, *solidTex, {spriteX, spriteY}, {projWidth, projHeight}, lights.tint(normDist, tileLight, LightTable::MIN_WALL_LIGHT));
         }
       }
     }
@@ -583,7 +459,7 @@ void RenderSystem::renderEnemies(Registry &registry, const Configuration &config
 
 
 
-void RenderSystem::renderProjectiles(Registry &registry, const Configuration &config, const TextureManager &textureManager, std::vector<RenderItem>& items)
+void RenderSystem::renderProjectiles(Registry &registry, const RenderCamera &camera, const TextureManager &textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue)
 {
   Entity player = INVALID_ENTITY;
   for (const auto &e : registry.entities())
@@ -603,13 +479,14 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
   if (rayResults->hits.empty()) return;
 
   const int amount_of_rays = static_cast<int>(rayResults->hits.size());
-  const float fov = config.fov;
-  const float halfFov = fov * 0.5f;
-  const float deltaAngle = fov / static_cast<float>(amount_of_rays);
+  const float halfFov = camera.halfFov;
+  const float deltaAngle = camera.fov / static_cast<float>(amount_of_rays);
   constexpr auto windowW = static_cast<float>(SCREEN_WIDTH);
   constexpr auto windowH = static_cast<float>(SCREEN_HEIGHT);
-  const float screenDist = (windowW * 0.5f) / std::tan(halfFov);
+  const float screenDist = camera.screenDist;
   const float columnWidth = windowW / static_cast<float>(amount_of_rays);
+  const float cullExtent = camera.tileSize * 0.5f;
+  const double playerAngleRad = radiansFromDegrees(rotComp->angle);
 
   struct ProjEntry { Entity e; float dist; const PositionComponent* pos; const ProjectileComponent* comp; };
   std::vector<ProjEntry> projs;
@@ -621,6 +498,8 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
     const auto* ppos = registry.getComponent<PositionComponent>(ent);
     const auto* pc = registry.getComponent<ProjectileComponent>(ent);
     if (!ppos || !pc) continue;
+    if (!rayResults->isAreaVisible(ppos->position, cullExtent, camera.tileSize)
+        && !isCentreColumnClear(*rayResults, posComp->position, playerAngleRad, halfFov, deltaAngle, ppos->position)) continue;
 
     const float dx = ppos->position.x - posComp->position.x;
     const float dy = ppos->position.y - posComp->position.y;
@@ -634,8 +513,6 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
 
   std::ranges::sort(projs, [](const ProjEntry& a, const ProjEntry& b){ return a.dist > b.dist; });
 
-  const double playerAngleRad = radiansFromDegrees(rotComp->angle);
-
   std::unordered_map<std::string, const sf::Texture*> textureCache;
 
   for (const auto &entry : projs)
@@ -666,8 +543,9 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
 
     const auto normDist = static_cast<float>(projDist * std::cos(delta));
     if (normDist <= SMALL_EPSILON) continue;
+    const std::uint8_t tileLight = camera.tileLighting ? lightGrid.atWorld(ppos->position) : LIGHTMAP_AMBIENT;
 
-    const float projTileSize = config.tile_size * std::max(0.05f, pc->visualSizeTiles);
+    const float projTileSize = camera.tileSize * std::max(0.05f, pc->visualSizeTiles);
     const float projHeight = screenDist * projTileSize / (normDist + SMALL_EPSILON);
     const float projWidth  = projHeight;
 
@@ -680,8 +558,7 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
     else { tex = textureManager.get(pc->textureId); textureCache[pc->textureId] = tex; }
 
     if (!tex) continue;
-
-    sf::Sprite sprite(*tex);
+    if (camera.mipmapping) tex = selectSpriteMip(textureManager, pc->textureId, *tex, projHeight * pc->spriteScale);
 
     const float texW = static_cast<float>(std::max(1u, tex->getSize().x));
     const float texH = static_cast<float>(std::max(1u, tex->getSize().y));
@@ -689,17 +566,6 @@ void RenderSystem::renderProjectiles(Registry &registry, const Configuration &co
     const float scaleX = (projWidth / texW) * pc->spriteScale;
     const float scaleY = (projHeight / texH) * pc->spriteScale;
 
-    sprite.setScale(scaleX, scaleY);
-    sprite.setPosition(spriteX, spriteY);
-
-    const float maxAttenuation = config.attenuation_distance * config.tile_size;
-    const float brightness = 1.f - std::min(normDist / maxAttenuation, 1.f);
-    const uint8_t bright = static_cast<uint8_t>(std::clamp(brightness * 255.f, 40.f, 255.f));
-    sprite.setColor(sf::Color(bright, bright, bright));
-
-    RenderItem it;
-    it.depth = normDist;
-    it.sprite = sprite;
-    items.push_back(std::move(it));
+    queue.push(normDist, RenderItemType::PROJECTILE, *tex, {spriteX, spriteY}, {scaleX, scaleY}, lights.tint(normDist, tileLight, LightTable::MIN_PROJECTILE_LIGHT));
   }
 }
@@ -6,32 +6,39 @@
 #define NULLP0INT_RENDERSYSTEM_H
 
 #include <vector>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
 
+#include "FloorCaster.h"
+#include "LightTable.h"
+#include "RenderCamera.h"
+#include "RenderQueue.h"
 #include "TextureManager.h"
+#include "TileLightGrid.h"
+#include "TileTextureTable.h"
 #include "../../Components.h"
 #include "../../Registry.h"
 #include "../../../configuration/Configuration.h"
 
 namespace ecs
 {
-  struct RenderItem
-  {
-    float depth = 0.f;
-    sf::Sprite sprite;
-  };
-
   class RenderSystem
   {
   public:
-    static void render(Registry &registry, const Configuration &config, sf::RenderWindow &window, const Entity &m_tilemap, float globalTime, const TextureManager &textureManager);
+    void render(Registry &registry, const Configuration &config, sf::RenderTarget &window, const Entity &m_tilemap, float globalTime, const TextureManager &textureManager);
 
   private:
-    static void renderFloor(Registry &registry, Configuration config, sf::RenderWindow &window, const Entity& m_tilemap, float playerRotationAngle, sf::Vector2f playerPos, const TextureManager& textureManager);
-    static void renderWalls(Registry &registry, Configuration config, const Entity& tilemapEntity, float playerAngle, const RayCastResultComponent& rayResults, float globalTime, const TextureManager& textureManager, std::vector<RenderItem>& items);
-    static void drawSolidColumn(sf::RenderWindow& window, float x, float y, float width, float height, float depth, float maxAttenuationDist);
-    static void renderEnemies(Registry &registry, const Configuration &config, const TextureManager &textureManager, std::vector<RenderItem>& items);
-    static void renderProjectiles(Registry &registry, const Configuration &config, const TextureManager &textureManager, std::vector<RenderItem>& items);
+    RenderCamera m_camera;
+    LightTable m_lights;
+    TileLightGrid m_lightGrid;
+    RenderQueue m_queue;
+    FloorCaster m_caster;
+    TileTextureTable m_tileTextures;
+
+    void renderFloor(Registry &registry, const RenderCamera &camera, sf::RenderTarget &window, const Entity& m_tilemap, float playerRotationAngle, sf::Vector2f playerPos, const TextureManager& textureManager, const LightTable& lights, const TileLightGrid& lightGrid);
+    void renderWalls(Registry &registry, const RenderCamera &camera, const Entity& tilemapEntity, float playerAngle, const RayCastResultComponent& rayResults, float globalTime, const TextureManager& textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue);
+    static void drawSolidColumn(sf::RenderTarget& window, float x, float y, float width, float height, float depth, float maxAttenuationDist);
+    static void renderEnemies(Registry &registry, const RenderCamera &camera, const TextureManager &textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue);
+    static void renderProjectiles(Registry &registry, const RenderCamera &camera, const TextureManager &textureManager, const LightTable& lights, const TileLightGrid& lightGrid, RenderQueue& queue);
   };
 }
 
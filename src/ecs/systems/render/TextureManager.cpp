@@ -4,25 +4,168 @@
 
 #include "TextureManager.h"
 
+#include <algorithm>
+#include <cmath>
+
 bool TextureManager::load(const std::string &id, const std::string &path)
 {
-  sf::Texture tex;
-  if (!tex.loadFromFile(path))
+  return load(id, path, {});
+}
+
+bool TextureManager::load(const std::string &id, const std::string &path, const std::vector<sf::IntRect> &frames)
+{
+  sf::Image image;
+  if (!image.loadFromFile(path))
   {
     return false;
   }
-  tex.setSmooth(false);
-  tex.setRepeated(true);
-  m_textures[id] = tex;
+
+  std::vector<sf::IntRect> regions = frames;
+  if (regions.empty())
+  {
+    regions.emplace_back(0, 0, static_cast<int>(image.getSize().x), static_cast<int>(image.getSize().y));
+  }
+
+  MipChain chain;
+  chain.images.reserve(MAX_MIP_LEVELS);
+  chain.images.push_back(image);
+  while (static_cast<int>(chain.images.size()) < MAX_MIP_LEVELS)
+  {
+    const sf::Vector2u size = chain.images.back().getSize();
+    if (size.x <= 1u && size.y <= 1u) break;
+    chain.images.push_back(downsample(chain.images.back(), regions, static_cast<int>(chain.images.size())));
+  }
+
+  chain.textures.resize(chain.images.size());
+  for (std::size_t level = 0; level < chain.images.size(); ++level)
+  {
+    sf::Texture& tex = chain.textures[level];
+    if (!tex.loadFromImage(chain.images[level]))
+    {
+      return false;
+    }
+    tex.setSmooth(false);
+    tex.setRepeated(true);
+  }
+
+  m_textures[id] = std::move(chain);
   return true;
 }
 
+sf::Image TextureManager::downsample(const sf::Image &source, const std::vector<sf::IntRect> &frames, const int targetLevel)
+{
+  const sf::Vector2u src = source.getSize();
+  const unsigned w = (src.x + 1u) / 2u;
+  const unsigned h = (src.y + 1u) / 2u;
+
+  std::vector<sf::Uint8> dst(static_cast<std::size_t>(w) * h * 4u);
+
+  const sf::Uint8* pixels = source.getPixelsPtr();
+  for (const sf::IntRect& frame : frames)
+  {
+    const sf::IntRect from = mipRect(frame, targetLevel - 1);
+    const sf::IntRect to = mipRect(frame, targetLevel);
+    if (from.width <= 0 || from.height <= 0) continue;
+
+    const int fromRight = std::min(from.left + from.width, static_cast<int>(src.x)) - 1;
+    const int fromBottom = std::min(from.top + from.height, static_cast<int>(src.y)) - 1;
+    const int toRight = std::min(to.left + to.width, static_cast<int>(w));
+    const int toBottom = std::min(to.top + to.height, static_cast<int>(h));
+    if (fromRight < from.left || fromBottom < from.top) continue;
+
+    for (int y = std::max(0, to.top); y < toBottom; ++y)
+    {
+      const int sy = from.top + (y - to.top) * 2;
+      const auto y0 = static_cast<unsigned>(std::min(sy, fromBottom));
+      const auto y1 = static_cast<unsigned>(std::min(sy + 1, fromBottom));
+      for (int x = std::max(0, to.left); x < toRight; ++x)
+      {
+        const int sx = from.left + (x - to.left) * 2;
+        const auto x0 = static_cast<unsigned>(std::min(sx, fromRight));
+        const auto x1 = static_cast<unsigned>(std::min(sx + 1, fromRight));
+
+        const sf::Uint8* p00 = pixels + (static_cast<std::size_t>(y0) * src.x + x0) * 4u;
+        const sf::Uint8* p10 = pixels + (static_cast<std::size_t>(y0) * src.x + x1) * 4u;
+        const sf::Uint8* p01 = pixels + (static_cast<std::size_t>(y1) * src.x + x0) * 4u;
+        const sf::Uint8* p11 = pixels + (static_cast<std::size_t>(y1) * src.x + x1) * 4u;
+
+        const unsigned a = p00[3] + p10[3] + p01[3] + p11[3];
+        sf::Uint8 rgb[3] = {0, 0, 0};
+        if (a > 0u)
+        {
+          for (int c = 0; c < 3; ++c)
+          {
+            const unsigned sum = p00[c] * p00[3] + p10[c] * p10[3] + p01[c] * p01[3] + p11[c] * p11[3];
+            rgb[c] = static_cast<sf::Uint8>((sum + a / 2u) / a);
+          }
+        }
+
+        sf::Uint8* out = dst.data() + (static_cast<std::size_t>(y) * w + static_cast<unsigned>(x)) * 4u;
+        out[0] = rgb[0];
+        out[1] = rgb[1];
+        out[2] = rgb[2];
+        out[3] = static_cast<sf::Uint8>((a + 2u) / 4u);
+      }
+    }
+  }
+
+  sf::Image image;
+  image.create(w, h, dst.data());
+  return image;
+}
+
 const sf::Texture *TextureManager::get(const std::string &id) const
+{
+  return get(id, 0);
+}
+
+const sf::Texture *TextureManager::get(const std::string &id, const int mipLevel) const
 {
   const auto it = m_textures.find(id);
-  if (it == m_textures.end())
+  if (it == m_textures.end() || it->second.textures.empty())
   {
     return nullptr;
   }
-  return &it->second;
+  const auto& levels = it->second.textures;
+  return &levels[static_cast<std::size_t>(std::clamp(mipLevel, 0, static_cast<int>(levels.size()) - 1))];
+}
+
+const sf::Image *TextureManager::getImage(const std::string &id) const
+{
+  return getImage(id, 0);
+}
+
+const sf::Image *TextureManager::getImage(const std::string &id, const int mipLevel) const
+{
+  const auto it = m_textures.find(id);
+  if (it == m_textures.end() || it->second.images.empty())
+  {
+    return nullptr;
+  }
+  const auto& levels = it->second.images;
+  return &levels[static_cast<std::size_t>(std::clamp(mipLevel, 0, static_cast<int>(levels.size()) - 1))];
+}
+
+int TextureManager::mipLevelCount(const std::string &id) const
+{
+  const auto it = m_textures.find(id);
+  return it == m_textures.end() ? 0 : static_cast<int>(it->second.textures.size());
+}
+
+int TextureManager::selectMipLevel(const float texelsPerPixel)
+{
+  if (!(texelsPerPixel > 1.f)) return 0;
+  return std::min(static_cast<int>(std::log2(texelsPerPixel)), MAX_MIP_LEVELS - 1);
+}
+
+sf::IntRect TextureManager::mipRect(const sf::IntRect &rect, const int mipLevel)
+{
+  if (mipLevel <= 0) return rect;
+
+  const int round = (1 << mipLevel) - 1;
+  const int left = (rect.left + round) >> mipLevel;
+  const int top = (rect.top + round) >> mipLevel;
+  const int right = (rect.left + rect.width + round) >> mipLevel;
+  const int bottom = (rect.top + rect.height + round) >> mipLevel;
+  return {left, top, std::max(1, right - left), std::max(1, bottom - top)};
 }
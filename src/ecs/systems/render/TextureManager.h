@@ -8,18 +8,37 @@
 #pragma once
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <SFML/Graphics.hpp>
 
 class TextureManager
 {
 public:
+  static constexpr int MAX_MIP_LEVELS = 8;
+
   bool load(const std::string& id, const std::string& path);
+  bool load(const std::string& id, const std::string& path, const std::vector<sf::IntRect>& frames);
 
   const sf::Texture* get(const std::string &id) const;
+  const sf::Texture* get(const std::string &id, int mipLevel) const;
+  const sf::Image* getImage(const std::string &id) const;
+  const sf::Image* getImage(const std::string &id, int mipLevel) const;
+  int mipLevelCount(const std::string &id) const;
+
+  [[nodiscard]] static int selectMipLevel(float texelsPerPixel);
+  [[nodiscard]] static sf::IntRect mipRect(const sf::IntRect& rect, int mipLevel);
 
 private:
-  std::unordered_map<std::string, sf::Texture> m_textures;
+  struct MipChain
+  {
+    std::vector<sf::Texture> textures;
+    std::vector<sf::Image> images;
+  };
+
+  std::unordered_map<std::string, MipChain> m_textures;
+
+  static sf::Image downsample(const sf::Image& source, const std::vector<sf::IntRect>& frames, int targetLevel);
 };
 
 
-#endif //NULLP0INT_TEXTUREMANAGER_H
\ No newline at end of file
+#endif //NULLP0INT_TEXTUREMANAGER_H
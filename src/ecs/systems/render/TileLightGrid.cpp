@@ -0,0 +1,119 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "TileLightGrid.h"
+
+#include <algorithm>
+
+namespace ecs
+{
+  void TileLightGrid::build(Registry& registry, const TilemapComponent& map)
+  {
+    const std::size_t count = static_cast<std::size_t>(map.width) * map.height;
+    m_width = map.width;
+    m_height = map.height;
+    m_invTileSize = 1.f / std::max(map.tileSize, 1e-3f);
+
+    if (map.bakedLight.size() == count)
+    {
+      m_light.assign(map.bakedLight.begin(), map.bakedLight.end());
+    }
+    else
+    {
+      m_light.assign(count, LIGHTMAP_AMBIENT);
+    }
+
+    m_active.clear();
+    for (const auto e : registry.entities())
+    {
+      const auto* light = registry.getComponent<PointLightComponent>(e);
+      if (!light) continue;
+
+      const auto* pos = registry.getComponent<PositionComponent>(e);
+      if (!pos) continue;
+
+      float intensity = light->intensity;
+      if (light->remainingSeconds >= 0.f && light->durationSeconds > 0.f)
+      {
+        intensity *= std::clamp(light->remainingSeconds / light->durationSeconds, 0.f, 1.f);
+      }
+      if (intensity < 1.f || light->radiusTiles <= 0.f) continue;
+
+      m_active.push_back(ActiveLight{pos->position, light->radiusTiles, intensity});
+    }
+
+    if (m_active.size() > MAX_DYNAMIC_LIGHTS)
+    {
+      std::ranges::partial_sort(m_active, m_active.begin() + MAX_DYNAMIC_LIGHTS,
+        [](const ActiveLight& a, const ActiveLight& b) { return a.intensity > b.intensity; });
+      m_active.resize(MAX_DYNAMIC_LIGHTS);
+    }
+
+    if (m_visitStamp.size() != count)
+    {
+      m_visitStamp.assign(count, 0u);
+      m_stamp = 0;
+    }
+
+    for (const auto& light : m_active)
+    {
+      splat(map, light);
+    }
+  }
+
+  void TileLightGrid::splat(const TilemapComponent& map, const ActiveLight& light)
+  {
+    const int ox = static_cast<int>(std::floor(light.position.x * m_invTileSize));
+    const int oy = static_cast<int>(std::floor(light.position.y * m_invTileSize));
+    if (ox < 0 || oy < 0 || ox >= static_cast<int>(m_width) || oy >= static_cast<int>(m_height)) return;
+
+    if (++m_stamp == 0)
+    {
+      std::ranges::fill(m_visitStamp, 0u);
+      m_stamp = 1;
+    }
+
+    const float cx = light.position.x * m_invTileSize;
+    const float cy = light.position.y * m_invTileSize;
+    const int reach = static_cast<int>(std::ceil(light.radiusTiles));
+
+    m_frontier.clear();
+    m_frontierSteps.clear();
+    m_frontier.push_back({ox, oy});
+    m_frontierSteps.push_back(0);
+    m_visitStamp[static_cast<std::size_t>(oy) * m_width + static_cast<std::size_t>(ox)] = m_stamp;
+
+    constexpr int dirs[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+    for (std::size_t head = 0; head < m_frontier.size(); ++head)
+    {
+      const sf::Vector2i cur = m_frontier[head];
+      const int steps = m_frontierSteps[head];
+      const std::size_t idx = static_cast<std::size_t>(cur.y) * m_width + static_cast<std::size_t>(cur.x);
+
+      const float dx = static_cast<float>(cur.x) + 0.5f - cx;
+      const float dy = static_cast<float>(cur.y) + 0.5f - cy;
+      const float falloff = 1.f - std::sqrt(dx * dx + dy * dy) / light.radiusTiles;
+      if (falloff > 0.f)
+      {
+        const int lit = static_cast<int>(m_light[idx]) + static_cast<int>(light.intensity * falloff);
+        m_light[idx] = static_cast<std::uint8_t>(std::min(lit, 255));
+      }
+
+      if (steps >= reach) continue;
+      for (const auto& d : dirs)
+      {
+        const int nx = cur.x + d[0];
+        const int ny = cur.y + d[1];
+        if (nx < 0 || ny < 0 || nx >= static_cast<int>(m_width) || ny >= static_cast<int>(m_height)) continue;
+        if (map.isWall(nx, ny)) continue;
+
+        const std::size_t nidx = static_cast<std::size_t>(ny) * m_width + static_cast<std::size_t>(nx);
+        if (m_visitStamp[nidx] == m_stamp) continue;
+        m_visitStamp[nidx] = m_stamp;
+        m_frontier.push_back({nx, ny});
+        m_frontierSteps.push_back(steps + 1);
+      }
+    }
+  }
+}
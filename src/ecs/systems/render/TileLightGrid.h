@@ -0,0 +1,63 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_TILELIGHTGRID_H
+#define NULLP0INT_TILELIGHTGRID_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <SFML/System/Vector2.hpp>
+
+#include "../../Components.h"
+#include "../../Registry.h"
+
+namespace ecs
+{
+  class TileLightGrid
+  {
+  public:
+    void build(Registry& registry, const TilemapComponent& map);
+
+    [[nodiscard]] std::uint8_t at(const int tx, const int ty) const
+    {
+      if (tx < 0 || ty < 0 || tx >= static_cast<int>(m_width) || ty >= static_cast<int>(m_height)) return LIGHTMAP_AMBIENT;
+      return m_light[static_cast<std::size_t>(ty) * m_width + static_cast<std::size_t>(tx)];
+    }
+
+    [[nodiscard]] std::uint8_t atWorld(const sf::Vector2f worldPos) const
+    {
+      return at(static_cast<int>(std::floor(worldPos.x * m_invTileSize)), static_cast<int>(std::floor(worldPos.y * m_invTileSize)));
+    }
+
+    [[nodiscard]] std::uint8_t faceLight(const RayHit& hit) const
+    {
+      return at(hit.faceTileX, hit.faceTileY);
+    }
+
+  private:
+    struct ActiveLight
+    {
+      sf::Vector2f position;
+      float radiusTiles = 0.f;
+      float intensity = 0.f;
+    };
+
+    unsigned m_width = 0;
+    unsigned m_height = 0;
+    float m_invTileSize = 1.f / 64.f;
+    std::vector<std::uint8_t> m_light;
+
+    std::vector<ActiveLight> m_active;
+    std::vector<std::uint32_t> m_visitStamp;
+    std::uint32_t m_stamp = 0;
+    std::vector<sf::Vector2i> m_frontier;
+    std::vector<int> m_frontierSteps;
+
+    void splat(const TilemapComponent& map, const ActiveLight& light);
+  };
+}
+
+#endif //NULLP0INT_TILELIGHTGRID_H
@@ -0,0 +1,25 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "TileTextureTable.h"
+
+namespace ecs
+{
+  void TileTextureTable::rebuild(const TilemapComponent& map, const TextureManager& textureManager, const float globalTime)
+  {
+    m_entries.fill(Entry{});
+
+    for (const auto& [tile, appearance] : map.tileAppearanceMap)
+    {
+      const std::string& texId = appearance.isAnimated() ?
+                                appearance.currentTextureId(globalTime) :
+                                appearance.singleTextureId;
+      if (texId.empty()) continue;
+
+      Entry& entry = m_entries[static_cast<unsigned char>(tile)];
+      entry.texture = textureManager.get(texId);
+      entry.textureId = entry.texture ? &texId : nullptr;
+    }
+  }
+}
@@ -0,0 +1,39 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_TILETEXTURETABLE_H
+#define NULLP0INT_TILETEXTURETABLE_H
+
+#include <array>
+#include <string>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include "TextureManager.h"
+#include "../../Components.h"
+
+namespace ecs
+{
+  class TileTextureTable
+  {
+  public:
+    struct Entry
+    {
+      const sf::Texture* texture = nullptr;
+      const std::string* textureId = nullptr;
+    };
+
+    void rebuild(const TilemapComponent& map, const TextureManager& textureManager, float globalTime);
+
+    [[nodiscard]] const Entry& operator[](const char tile) const
+    {
+      return m_entries[static_cast<unsigned char>(tile)];
+    }
+
+  private:
+    std::array<Entry, 256> m_entries{};
+  };
+}
+
+#endif //NULLP0INT_TILETEXTURETABLE_H
@@ -15,6 +15,7 @@
 #include "../../../game/weapons/Weapon.h"
 #include "../../../math/mathUtils.h"
 #include "../collision/CollisionSystem.h"
+#include "../physics/InterpolationSystem.h"
 
 namespace
 {
@@ -108,6 +109,17 @@ namespace
     return (hit.distance > 0.f && std::isfinite(hit.distance)) ? hit.distance : 0.f;
   }
 
+  void emitMuzzleFlash(ecs::Registry& registry, const ecs::Entity playerEntity)
+  {
+    const ecs::PointLightComponent flash{MUZZLE_FLASH_RADIUS_TILES, MUZZLE_FLASH_INTENSITY, MUZZLE_FLASH_SECONDS, MUZZLE_FLASH_SECONDS};
+    if (auto* light = registry.getComponent<ecs::PointLightComponent>(playerEntity))
+    {
+      *light = flash;
+      return;
+    }
+    registry.addComponent<ecs::PointLightComponent>(playerEntity, flash);
+  }
+
   void startFireAnimation(ecs::WeaponSlotRuntime& slot)
   {
     if (!slot.weapon) return;
@@ -342,6 +354,8 @@ namespace
     pc.parried = false;
 
     registry.addComponent<ecs::ProjectileComponent>(proj, pc);
+    registry.addComponent<ecs::PointLightComponent>(proj, ecs::PointLightComponent{PROJECTILE_LIGHT_RADIUS_TILES, PROJECTILE_LIGHT_INTENSITY});
+    ecs::InterpolationSystem::snap(registry, proj);
     return proj;
   }
 }
@@ -472,6 +486,7 @@ void ecs::WeaponSystem::update(Registry& registry, const Configuration& config,
       (void)spawnProjectileFromWeapon(registry, config, tilemapEntity, playerEntity, pos->position, ownerRadius, aimDir, *activeSlot.weapon);
     }
 
+    emitMuzzleFlash(registry, playerEntity);
     startFireAnimation(activeSlot);
   }
 
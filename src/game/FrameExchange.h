@@ -0,0 +1,68 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_FRAMEEXCHANGE_H
+#define NULLP0INT_FRAMEEXCHANGE_H
+
+#include <array>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+template<typename Frame>
+class FrameExchange
+{
+public:
+  Frame& writeSlot()
+  {
+    return m_slots[m_write];
+  }
+
+  void publish()
+  {
+    std::unique_lock lock(m_mutex);
+    m_consumed.wait(lock, [this] { return !m_fresh || m_stopped; });
+    if (m_stopped) return;
+
+    std::swap(m_write, m_ready);
+    m_fresh = true;
+    m_published.notify_one();
+  }
+
+  Frame* acquire()
+  {
+    std::unique_lock lock(m_mutex);
+    m_published.wait(lock, [this] { return m_fresh || m_stopped; });
+    if (m_stopped) return nullptr;
+
+    std::swap(m_read, m_ready);
+    m_fresh = false;
+    m_consumed.notify_one();
+    return &m_slots[m_read];
+  }
+
+  void stop()
+  {
+    {
+      std::lock_guard lock(m_mutex);
+      m_stopped = true;
+    }
+    m_published.notify_all();
+    m_consumed.notify_all();
+  }
+
+private:
+  std::array<Frame, 3> m_slots{};
+  std::size_t m_write = 0;
+  std::size_t m_ready = 1;
+  std::size_t m_read = 2;
+  bool m_fresh = false;
+  bool m_stopped = false;
+
+  std::mutex m_mutex;
+  std::condition_variable m_published;
+  std::condition_variable m_consumed;
+};
+
+#endif //NULLP0INT_FRAMEEXCHANGE_H
@@ -18,11 +18,12 @@
 #include "../ecs/systems/map/MapLoaderSystem.h"
 #include "../ecs/systems/map_generation/MapGenerationSystem.h"
 #include "../ecs/systems/npc/EnemyControllerSystem.h"
+#include "../ecs/systems/physics/InterpolationSystem.h"
 #include "../ecs/systems/physics/PhysicsSystem.h"
 #include "../ecs/systems/projectile/ProjectileSystem.h"
 #include "../ecs/systems/render/AnimationSystem.h"
+#include "../ecs/systems/render/LightingSystem.h"
 #include "../ecs/systems/render/RayCasting.h"
-#include "../ecs/systems/render/RenderSystem.h"
 #include "../ecs/systems/weapon/WeaponSystem.h"
 
 Game::Game(const unsigned windowW, const unsigned windowH, const std::string& title, const unsigned antialiasing)
@@ -33,25 +34,77 @@ Game::Game(const unsigned windowW, const unsigned windowH, const std::string& ti
       sf::ContextSettings{0, 0, antialiasing}
     )
 {
-  m_window.setFramerateLimit(60);
+  m_window.setVerticalSyncEnabled(m_config.vertical_sync);
+  m_window.setFramerateLimit(m_config.frame_rate_limit);
   init();
 }
 
+Game::~Game()
+{
+  stopRenderThread();
+}
+
 void Game::run()
 {
+  m_window.setActive(false);
+  m_renderThread = std::thread(&Game::renderLoop, this);
+
   sf::Clock clock;
   while (m_window.isOpen())
   {
+    if (isIdle() && !m_redrawRequested)
+    {
+      sf::Event event{};
+      if (!m_window.waitEvent(event)) continue;
+      handleEvent(event);
+      clock.restart();
+    }
+
     const float dt = clock.restart().asSeconds();
     handleEvents();
+    if (!m_window.isOpen()) break;
+
     update(dt);
-    render();
+
+    if (m_state == GlobalState::Playing)
+    {
+      m_dynamicResolution.update(m_renderWorkSeconds.load(std::memory_order_relaxed), m_config);
+    }
+
+    publishFrame();
+    m_redrawRequested = false;
   }
+
+  stopRenderThread();
+}
+
+void Game::renderLoop()
+{
+  m_window.setActive(true);
+
+  sf::Clock workClock;
+  while (FrameSnapshot* frame = m_frames.acquire())
+  {
+    workClock.restart();
+    render(*frame);
+    m_renderWorkSeconds.store(workClock.getElapsedTime().asSeconds(), std::memory_order_relaxed);
+
+    m_window.display();
+  }
+
+  m_window.setActive(false);
+}
+
+void Game::stopRenderThread()
+{
+  m_frames.stop();
+  if (m_renderThread.joinable()) m_renderThread.join();
 }
 
 void Game::init()
 {
   m_uiFontLoaded = loadUiFont(m_uiFont);
+  init_textures();
   setState(GlobalState::MainMenu);
 
   setMouseCaptured(m_window, false);
@@ -69,6 +122,7 @@ void Game::init_textures()
 {
   m_textureManager.load("wall_texture", "resources/assets/DOOR2_4.png");
   m_textureManager.load("floor", "resources/assets/FLAT5_8.png");
+  m_textureManager.load("exit_floor", "resources/assets/FLAT22.png");
   m_textureManager.load("step1", "resources/assets/STEP1.png");
   m_textureManager.load("step2", "resources/assets/STEP2.png");
   m_textureManager.load("sinner", "resources/assets/WALL50_1.png");
@@ -130,7 +184,10 @@ void Game::init_textures()
   m_textureManager.load("support_walk_back_2", "resources/assets/SPOSC5.png");
   m_textureManager.load("support_attack_1", "resources/assets/SPOSE1.png");
   m_textureManager.load("support_attack_2", "resources/assets/SPOSF1.png");
+}
 
+void Game::init_tile_appearance()
+{
   if (auto* tm = m_registry.getComponent<ecs::TilemapComponent>(m_tilemap))
   {
     tm->tileAppearanceMap['#'] = {"wall_texture", {}};
@@ -146,6 +203,7 @@ void Game::init_textures()
     tm->tileAppearanceMap['e'] = {"ewall", {}};
     tm->tileAppearanceMap['>'] = {"exit_wall", {}};
     tm->floorTextureId = "floor";
+    tm->markTilesChanged();
   }
 }
 
@@ -169,49 +227,60 @@ void Game::handleEvents()
   sf::Event event{};
   while (m_window.pollEvent(event))
   {
-    if (event.type == sf::Event::Closed)
+    handleEvent(event);
+  }
+}
+
+void Game::handleEvent(const sf::Event& event)
+{
+  if (event.type == sf::Event::Closed)
+  {
+    stopRenderThread();
+    m_window.close();
+    return;
+  }
+
+  if (event.type == sf::Event::Resized)
+  {
+    m_worldCaptureNeeded = true;
+  }
+
+  if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
+  {
+    if (m_state == GlobalState::Playing)
     {
-      m_window.close();
-      continue;
+      setState(GlobalState::Paused);
     }
-
-    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
+    else if (m_state == GlobalState::Paused)
     {
-      if (m_state == GlobalState::Playing)
-      {
-        setState(GlobalState::Paused);
-      }
-      else if (m_state == GlobalState::Paused)
-      {
-        setState(GlobalState::Playing);
-      }
-      else if (m_state == GlobalState::MapSelect)
-      {
-        setState(GlobalState::MainMenu);
-      }
+      setState(GlobalState::Playing);
     }
-
-    if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::E)
+    else if (m_state == GlobalState::MapSelect)
     {
-      if (m_state == GlobalState::Playing)
-      {
-        tryOpenExit();
-      }
+      setState(GlobalState::MainMenu);
     }
+  }
 
-    if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left)
+  if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::E)
+  {
+    if (m_state == GlobalState::Playing)
     {
-      if (m_state == GlobalState::Playing) continue;
+      tryOpenExit();
+    }
+  }
+
+  if (event.type == sf::Event::MouseButtonReleased && event.mouseButton.button == sf::Mouse::Left)
+  {
+    if (m_state == GlobalState::Playing) return;
 
-      const sf::Vector2f mp = m_window.mapPixelToCoords({event.mouseButton.x, event.mouseButton.y});
-      const auto buttons = buildButtonsForState(m_state);
-      for (std::size_t i = 0; i < buttons.size(); ++i)
+    const sf::Vector2f mp = m_window.mapPixelToCoords({event.mouseButton.x, event.mouseButton.y}, m_window.getDefaultView());
+    const auto buttons = buildButtonsForState(m_state);
+    for (std::size_t i = 0; i < buttons.size(); ++i)
+    {
+      if (buttons[i].rect.contains(mp))
       {
-        if (buttons[i].rect.contains(mp))
-        {
-          onMenuButtonPressed(i);
-          break;
-        }
+        onMenuButtonPressed(i);
+        break;
       }
     }
   }
@@ -230,97 +299,200 @@ void Game::update(const float dt)
     s_captureApplied = captureMouse;
   }
 
-  const float mouseDx = consumeMouseDeltaX(m_window, captureMouse);
+  m_pendingMouseDx += consumeMouseDeltaX(m_window, captureMouse);
 
   if (m_state == GlobalState::Playing)
   {
-    m_worldTimeSeconds += dtSafe;
-
-    ecs::InputSystem::update(m_registry, m_config, dtSafe, mouseDx);
-    ecs::EnemyControllerSystem::update(m_registry, m_tilemap, dtSafe);
-    ecs::AnimationSystem::update(m_registry, dtSafe);
-    ecs::PhysicsSystem::update(m_registry, dtSafe, m_tilemap);
-    ecs::RayCasting::rayCast(m_registry, m_config, m_player);
-    ecs::WeaponSystem::update(m_registry, m_config, m_tilemap, m_player, dtSafe);
-    ecs::ProjectileSystem::update(m_registry, m_config, m_tilemap, dtSafe);
+    constexpr float maxAccumulated = FIXED_TIMESTEP_SECONDS * static_cast<float>(MAX_SIMULATION_STEPS_PER_FRAME);
+    m_simulationAccumulator = std::min(m_simulationAccumulator + dtSafe, maxAccumulated);
+
+    const int steps = static_cast<int>(m_simulationAccumulator / FIXED_TIMESTEP_SECONDS);
+    if (steps > 0)
+    {
+      const float mouseDxPerStep = m_pendingMouseDx / static_cast<float>(steps);
+      m_pendingMouseDx = 0.f;
+
+      for (int i = 0; i < steps && m_state == GlobalState::Playing; ++i)
+      {
+        ecs::InterpolationSystem::snapshot(m_registry);
+        simulate(FIXED_TIMESTEP_SECONDS, mouseDxPerStep);
+        m_simulationAccumulator -= FIXED_TIMESTEP_SECONDS;
+      }
+    }
+  }
+  else
+  {
+    m_pendingMouseDx = 0.f;
   }
 
   if (m_state == GlobalState::Playing || m_state == GlobalState::Paused)
   {
     m_hud.update(dtSafe, m_registry, m_player);
   }
+}
+
+void Game::simulate(const float dt, const float mouseDx)
+{
+  m_worldTimeSeconds += dt;
 
-  if (m_state != GlobalState::Playing) return;
+  ecs::InputSystem::update(m_registry, m_config, dt, mouseDx);
+  m_enemyController.update(m_registry, m_config, m_tilemap, dt);
+  ecs::AnimationSystem::update(m_registry, dt);
+  ecs::PhysicsSystem::update(m_registry, dt, m_tilemap);
+  ecs::WeaponSystem::update(m_registry, m_config, m_tilemap, m_player, dt);
+  ecs::ProjectileSystem::update(m_registry, m_config, m_tilemap, dt);
+  ecs::LightingSystem::update(m_registry, dt);
 
-  if (m_player != ecs::INVALID_ENTITY)
+  if (m_player == ecs::INVALID_ENTITY) return;
+
+  if (auto* hp = m_registry.getComponent<ecs::HealthComponent>(m_player))
   {
-    if (auto* hp = m_registry.getComponent<ecs::HealthComponent>(m_player))
+    if (hp->current <= 0.f)
     {
-      if (hp->current <= 0.f)
-      {
-        hp->current = 0.f;
-        setState(GlobalState::DeathMenu);
-      }
+      hp->current = 0.f;
+      setState(GlobalState::DeathMenu);
     }
   }
 }
 
-void Game::drawHud()
+void Game::drawHud(FrameSnapshot& frame)
 {
-  m_hud.draw(m_window, m_registry, m_player, m_uiFont, m_uiFontLoaded);
+  m_hudView.draw(m_window, frame.windowSize, frame.hud, m_uiFont, m_uiFontLoaded);
 }
 
-void Game::render()
+void Game::publishFrame()
 {
-  m_window.clear(sf::Color::Black);
+  FrameSnapshot& frame = m_frames.writeSlot();
+  frame.config = m_config;
+  frame.player = m_player;
+  frame.tilemap = m_tilemap;
+  frame.state = m_state;
+  frame.worldTimeSeconds = m_worldTimeSeconds;
+  frame.windowSize = m_window.getSize();
+  frame.hud = m_hud.frame(m_registry, m_player);
+  frame.buttons = buildButtonsForState(m_state);
+
+  frame.hasWorld = showsWorld(m_state) && m_tilemap != ecs::INVALID_ENTITY;
+  frame.captureWorld = frame.hasWorld && isIdle() && m_worldCaptureNeeded;
+  frame.includesWorld = frame.hasWorld && (!isIdle() || frame.captureWorld);
+
+  if (frame.includesWorld) snapshotWorld(frame);
+  if (frame.captureWorld) m_worldCaptureNeeded = false;
+
+  m_frames.publish();
+}
 
-  const bool hasWorld =
-    (m_state == GlobalState::Playing
-      || m_state == GlobalState::Paused
-      || m_state == GlobalState::UpgradeMenu
-      || m_state == GlobalState::WinMenu
-      || m_state == GlobalState::DeathMenu);
+void Game::snapshotWorld(FrameSnapshot& frame)
+{
+  ecs::InterpolationSystem::apply(m_registry, m_simulationAccumulator / FIXED_TIMESTEP_SECONDS);
+  m_rayCasting.rayCast(m_registry, m_config, m_player);
+
+  ecs::Registry& world = frame.world;
+  world.mirrorEntities(m_registry);
+  world.copyComponents<ecs::PlayerTag>(m_registry);
+  world.copyComponents<ecs::EnemyTag>(m_registry);
+  world.copyComponents<ecs::ProjectileTag>(m_registry);
+  world.copyComponents<ecs::PositionComponent>(m_registry);
+  world.copyComponents<ecs::RotationComponent>(m_registry);
+  world.copyComponents<ecs::SpriteComponent>(m_registry);
+  world.copyComponents<ecs::EnemyComponent>(m_registry);
+  world.copyComponents<ecs::ProjectileComponent>(m_registry);
+  world.copyComponents<ecs::PointLightComponent>(m_registry);
+  world.copyComponents<ecs::RayCastResultComponent>(m_registry);
+  world.copyComponents<ecs::ParryComponent>(m_registry);
+  world.copyComponents<ecs::WeaponInventoryComponent>(m_registry);
+
+  const auto* tm = m_registry.getComponent<ecs::TilemapComponent>(m_tilemap);
+  const std::uint32_t tilemapRevision = tm ? tm->revision : 0;
+  if (tilemapRevision == 0 || tilemapRevision != frame.tilemapRevision)
+  {
+    world.copyComponents<ecs::TilemapComponent>(m_registry);
+    frame.tilemapRevision = tilemapRevision;
+  }
+
+  ecs::InterpolationSystem::restore(m_registry);
+}
+
+void Game::render(FrameSnapshot& frame)
+{
+  m_window.clear(sf::Color::Black);
 
-  if (hasWorld && m_tilemap != ecs::INVALID_ENTITY)
+  if (frame.includesWorld)
   {
-    ecs::RenderSystem::render(m_registry, m_config, m_window, m_tilemap, m_worldTimeSeconds, m_textureManager);
+    sf::RenderTarget& scene = m_renderScaler.begin(m_window, frame.windowSize, frame.config);
+    m_renderSystem.render(frame.world, frame.config, scene, frame.tilemap, frame.worldTimeSeconds, m_textureManager);
+    m_renderScaler.present(m_window, frame.windowSize);
 
-    if (m_state == GlobalState::Playing || m_state == GlobalState::Paused)
+    if (frame.state == GlobalState::Playing || frame.state == GlobalState::Paused)
     {
-      drawWeaponView();
-      drawHud();
+      drawWeaponView(frame.world, frame.player, frame.windowSize);
+      drawHud(frame);
     }
+
+    if (frame.captureWorld) captureWorldSnapshot(frame.windowSize);
+  }
+  else if (frame.hasWorld)
+  {
+    drawWorldSnapshot(frame.windowSize);
   }
 
-  switch (m_state)
+  switch (frame.state)
   {
     case GlobalState::MainMenu:
-      drawMenu("NULLP0INT", buildButtonsForState(m_state), false);
+      drawMenu(frame.windowSize, "NULLP0INT", frame.buttons, false);
       break;
 
     case GlobalState::MapSelect:
-      drawMenu("Выбор уровня", buildButtonsForState(m_state), false);
+      drawMenu(frame.windowSize, "Выбор уровня", frame.buttons, false);
       break;
 
     case GlobalState::Paused:
-      drawMenu("Пауза", buildButtonsForState(m_state), true);
+      drawMenu(frame.windowSize, "Пауза", frame.buttons, true);
       break;
 
     case GlobalState::UpgradeMenu:
-      drawMenu("Выберите улучшение", buildButtonsForState(m_state), true);
+      drawMenu(frame.windowSize, "Выберите улучшение", frame.buttons, true);
       break;
 
     case GlobalState::WinMenu:
-      drawMenu("Вы выиграли!", buildButtonsForState(m_state), true);
+      drawMenu(frame.windowSize, "Вы выиграли!", frame.buttons, true);
       break;
 
     case GlobalState::DeathMenu:
-      drawMenu("Вы умерли", buildButtonsForState(m_state), true);
+      drawMenu(frame.windowSize, "Вы умерли", frame.buttons, true);
       break;
 
     case GlobalState::Playing:
       break;
   }
+}
 
-  m_window.display();
+bool Game::isIdle() const
+{
+  return m_state != GlobalState::Playing;
+}
+
+bool Game::showsWorld(const GlobalState state)
+{
+  return state == GlobalState::Playing
+    || state == GlobalState::Paused
+    || state == GlobalState::UpgradeMenu
+    || state == GlobalState::WinMenu
+    || state == GlobalState::DeathMenu;
+}
+
+void Game::captureWorldSnapshot(const sf::Vector2u size)
+{
+  if (m_worldSnapshot.getSize() != size && !m_worldSnapshot.create(size.x, size.y)) return;
+
+  m_worldSnapshot.update(m_window);
+  m_worldSnapshotSprite.setTexture(m_worldSnapshot, true);
+}
+
+void Game::drawWorldSnapshot(const sf::Vector2u size)
+{
+  const sf::View previous = m_window.getView();
+  m_window.setView(sf::View(sf::FloatRect(0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y))));
+  m_window.draw(m_worldSnapshotSprite);
+  m_window.setView(previous);
 }
@@ -5,15 +5,26 @@
 #ifndef NULLP0INT_GAME_H
 #define NULLP0INT_GAME_H
 
+#include <atomic>
+#include <cstdint>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <SFML/Graphics.hpp>
 
+#include "FrameExchange.h"
 #include "Hud.h"
+#include "HudView.h"
+#include "MenuView.h"
 #include "../constants.h"
 #include "../configuration/Configuration.h"
 #include "../ecs/Registry.h"
+#include "../ecs/systems/npc/EnemyControllerSystem.h"
+#include "../ecs/systems/render/DynamicResolution.h"
+#include "../ecs/systems/render/RayCasting.h"
+#include "../ecs/systems/render/RenderScaler.h"
+#include "../ecs/systems/render/RenderSystem.h"
 #include "../ecs/systems/render/TextureManager.h"
 
 struct UIButton
@@ -30,6 +41,8 @@ public:
                 const std::string& title = "NULLP0INT",
                 unsigned antialiasing = 0);
 
+  ~Game();
+
   void run();
 
 private:
@@ -50,14 +63,36 @@ private:
     Procedural,
   };
 
+  struct FrameSnapshot
+  {
+    Configuration config;
+    ecs::Registry world;
+    ecs::Entity player = ecs::INVALID_ENTITY;
+    ecs::Entity tilemap = ecs::INVALID_ENTITY;
+    GlobalState state = GlobalState::MainMenu;
+    std::uint32_t tilemapRevision = 0;
+    float worldTimeSeconds = 0.f;
+    sf::Vector2u windowSize;
+    Hud::Frame hud;
+    bool hasWorld = false;
+    bool includesWorld = false;
+    bool captureWorld = false;
+    std::vector<UIButton> buttons;
+  };
+
   sf::RenderWindow m_window;
   ecs::Registry m_registry;
   TextureManager m_textureManager;
+  ecs::RenderScaler m_renderScaler;
+  ecs::RayCasting m_rayCasting;
+  ecs::RenderSystem m_renderSystem;
+  ecs::DynamicResolution m_dynamicResolution;
 
   Configuration m_config;
 
   ecs::Entity m_player = ecs::INVALID_ENTITY;
   ecs::Entity m_tilemap = ecs::INVALID_ENTITY;
+  ecs::EnemyControllerSystem m_enemyController;
 
   bool m_campaignActive = false;
   int m_campaignLevelIndex = 0;
@@ -65,13 +100,27 @@ private:
 
   GlobalState m_state = GlobalState::MainMenu;
   float m_worldTimeSeconds = 0.f;
+  float m_simulationAccumulator = 0.f;
+  float m_pendingMouseDx = 0.f;
 
   sf::Font m_uiFont;
   bool m_uiFontLoaded = false;
 
   Hud m_hud;
+  HudView m_hudView;
+  MenuView m_menuView;
+
+  sf::Texture m_worldSnapshot;
+  sf::Sprite m_worldSnapshotSprite;
+  bool m_worldCaptureNeeded = true;
+  bool m_redrawRequested = true;
+
+  FrameExchange<FrameSnapshot> m_frames;
+  std::thread m_renderThread;
+  std::atomic<float> m_renderWorkSeconds{0.f};
 
   void init_textures();
+  void init_tile_appearance();
   void init_player();
   void init_tilemap(MapChoice choice);
   void init();
@@ -84,16 +133,29 @@ private:
   bool tryOpenExit();
 
   [[nodiscard]] std::vector<UIButton> buildButtonsForState(GlobalState state) const;
-  void drawMenu(const std::string& title, const std::vector<UIButton>& buttons, bool darkenBackground);
-  void drawHud();
-  void drawWeaponView();
+  void drawMenu(sf::Vector2u windowSize, const std::string& title, const std::vector<UIButton>& buttons,
+                bool darkenBackground);
+  void drawHud(FrameSnapshot& frame);
+  void drawWeaponView(ecs::Registry& world, ecs::Entity player, sf::Vector2u windowSize);
   void setState(GlobalState next);
 
   void onMenuButtonPressed(std::size_t buttonIndex);
 
+  [[nodiscard]] bool isIdle() const;
+  [[nodiscard]] static bool showsWorld(GlobalState state);
+  void captureWorldSnapshot(sf::Vector2u size);
+  void drawWorldSnapshot(sf::Vector2u size);
+
+  void publishFrame();
+  void snapshotWorld(FrameSnapshot& frame);
+  void renderLoop();
+  void stopRenderThread();
+
   void handleEvents();
+  void handleEvent(const sf::Event& event);
   void update(float dt);
-  void render();
+  void simulate(float dt, float mouseDx);
+  void render(FrameSnapshot& frame);
 };
 
 #endif //NULLP0INT_GAME_H
@@ -31,7 +31,10 @@ namespace
 
 void Game::setState(const GlobalState next)
 {
+  if (next != m_state) m_worldCaptureNeeded = true;
+
   m_state = next;
+  m_redrawRequested = true;
 }
 
 void Game::returnToMainMenu()
@@ -68,9 +71,11 @@ void Game::startNewGame(const MapChoice choice)
   m_player = ecs::INVALID_ENTITY;
   m_tilemap = ecs::INVALID_ENTITY;
   m_worldTimeSeconds = 0.f;
+  m_simulationAccumulator = 0.f;
+  m_enemyController.reset();
 
   init_tilemap(choice);
-  init_textures();
+  init_tile_appearance();
   init_player();
   spawnEnemiesFromMap(m_registry, m_tilemap, m_config);
 
@@ -106,9 +111,11 @@ void Game::loadCampaignLevel(const int index)
   m_player = ecs::INVALID_ENTITY;
   m_tilemap = ecs::INVALID_ENTITY;
   m_worldTimeSeconds = 0.f;
+  m_simulationAccumulator = 0.f;
+  m_enemyController.reset();
 
   m_tilemap = ecs::MapLoaderSystem::load(m_registry, m_config, m_campaignMapPaths[static_cast<std::size_t>(index)]);
-  init_textures();
+  init_tile_appearance();
   init_player();
   spawnEnemiesFromMap(m_registry, m_tilemap, m_config);
 
@@ -222,6 +229,7 @@ void Game::onMenuButtonPressed(const std::size_t buttonIndex)
       }
       else if (buttonIndex == 1)
       {
+        stopRenderThread();
         m_window.close();
       }
       break;
@@ -273,6 +281,7 @@ void Game::onMenuButtonPressed(const std::size_t buttonIndex)
       }
       else if (buttonIndex == 1)
       {
+        stopRenderThread();
         m_window.close();
       }
       break;
@@ -282,31 +291,18 @@ void Game::onMenuButtonPressed(const std::size_t buttonIndex)
   }
 }
 
-void Game::drawMenu(const std::string& title, const std::vector<UIButton>& buttons, const bool darkenBackground)
+void Game::drawMenu(const sf::Vector2u windowSize, const std::string& title, const std::vector<UIButton>& buttons,
+                    const bool darkenBackground)
 {
-  if (darkenBackground)
-  {
-    sf::RectangleShape overlay;
-    overlay.setSize({static_cast<float>(m_window.getSize().x), static_cast<float>(m_window.getSize().y)});
-    overlay.setPosition(0.f, 0.f);
-    overlay.setFillColor(sf::Color(0, 0, 0, 140));
-    m_window.draw(overlay);
-  }
-
-  drawTitle(m_window, m_uiFont, title, m_uiFontLoaded, 160.f);
-
-  for (const auto& b : buttons)
-  {
-    drawButton(m_window, m_uiFont, b, m_uiFontLoaded);
-  }
+  m_menuView.draw(m_window, windowSize, m_uiFont, m_uiFontLoaded, title, buttons, darkenBackground);
 }
 
-void Game::drawWeaponView()
+void Game::drawWeaponView(ecs::Registry& world, const ecs::Entity player, const sf::Vector2u windowSize)
 {
-  if (m_player == ecs::INVALID_ENTITY) return;
-  if (!m_registry.isAlive(m_player)) return;
+  if (player == ecs::INVALID_ENTITY) return;
+  if (!world.isAlive(player)) return;
 
-  const auto* inv = m_registry.getComponent<ecs::WeaponInventoryComponent>(m_player);
+  const auto* inv = world.getComponent<ecs::WeaponInventoryComponent>(player);
   if (!inv) return;
   if (inv->slots.empty()) return;
 
@@ -316,7 +312,7 @@ void Game::drawWeaponView()
 
   std::string texId;
 
-  if (const auto* parry = m_registry.getComponent<ecs::ParryComponent>(m_player);
+  if (const auto* parry = world.getComponent<ecs::ParryComponent>(player);
     parry && parry->parrying)
   {
     static const std::string kFrames[3] = {"parry1", "parry2", "parry3"};
@@ -346,7 +342,7 @@ void Game::drawWeaponView()
   sf::Sprite spr;
   spr.setTexture(*tex);
 
-  const auto ws = m_window.getSize();
+  const auto ws = windowSize;
   const auto tsz = tex->getSize();
   if (tsz.x == 0u || tsz.y == 0u) return;
 
@@ -7,7 +7,6 @@
 #include "GameUI.h"
 
 #include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Window/Mouse.hpp>
 
 #include "Game.h"
@@ -75,47 +74,3 @@ void setMouseCaptured(sf::RenderWindow& window, const bool captured)
 
   return static_cast<float>(dx);
 }
-
-void drawButton(sf::RenderWindow& window, const sf::Font& font, const UIButton& b, const bool fontLoaded)
-{
-  const sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
-  const bool hovered = b.rect.contains(mousePos);
-
-  sf::RectangleShape shape;
-  shape.setPosition({b.rect.left, b.rect.top});
-  shape.setSize({b.rect.width, b.rect.height});
-  shape.setFillColor(hovered ? sf::Color(55, 55, 55, 235) : sf::Color(30, 30, 30, 235));
-  shape.setOutlineThickness(2.f);
-  shape.setOutlineColor(hovered ? sf::Color(200, 200, 200) : sf::Color(120, 120, 120));
-  window.draw(shape);
-
-  if (!fontLoaded) return;
-
-  sf::Text text;
-  text.setFont(font);
-  text.setString(toSfStringUtf8(b.label));
-  text.setCharacterSize(32);
-  text.setFillColor(sf::Color::White);
-
-  const sf::FloatRect bounds = text.getLocalBounds();
-  const float tx = b.rect.left + (b.rect.width - bounds.width) * 0.5f - bounds.left;
-  const float ty = b.rect.top + (b.rect.height - bounds.height) * 0.5f - bounds.top;
-  text.setPosition(tx, ty);
-  window.draw(text);
-}
-
-void drawTitle(sf::RenderWindow& window, const sf::Font& font, const std::string& title, const bool fontLoaded, const float y)
-{
-  if (!fontLoaded) return;
-
-  sf::Text text;
-  text.setFont(font);
-  text.setString(toSfStringUtf8(title));
-  text.setCharacterSize(64);
-  text.setFillColor(sf::Color::White);
-
-  const sf::FloatRect b = text.getLocalBounds();
-  const float x = (static_cast<float>(window.getSize().x) - b.width) * 0.5f - b.left;
-  text.setPosition(x, y);
-  window.draw(text);
-}
\ No newline at end of file
@@ -16,7 +16,5 @@
 void setMouseCaptured(sf::RenderWindow& window, bool captured);
 [[nodiscard]] sf::Vector2i windowCenterPx(const sf::RenderWindow& window);
 [[nodiscard]] float consumeMouseDeltaX(const sf::RenderWindow& window, bool captureNow);
-void drawButton(sf::RenderWindow& window, const sf::Font& font, const UIButton& b, bool fontLoaded);
-void drawTitle(sf::RenderWindow& window, const sf::Font& font, const std::string& title, bool fontLoaded, float y);
 
 #endif //NULLP0INT_GAMEUI_H
\ No newline at end of file
@@ -7,11 +7,8 @@
 
 #pragma once
 
-#include <SFML/Graphics/Color.hpp>
-#include <SFML/Graphics/Font.hpp>
-#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Config.hpp>
 
-#include "../constants.h"
 #include "../ecs/Entity.h"
 #include "../ecs/Registry.h"
 
@@ -23,6 +20,8 @@ public:
     float armLength = 14.f;
     float thickness = 3.f;
     float gap = 7.f;
+
+    bool operator==(const CrosshairStyle&) const = default;
   };
 
   struct HitMarkerStyle
@@ -30,6 +29,8 @@ public:
     float armLength = 12.f;
     float thickness = 3.f;
     float gap = 14.f;
+
+    bool operator==(const HitMarkerStyle&) const = default;
   };
 
   struct DamageVignetteStyle
@@ -39,6 +40,23 @@ public:
     float exponent = 1.8f;
     sf::Uint8 maxAlpha = 140;
     int grid = 9;
+
+    bool operator==(const DamageVignetteStyle&) const = default;
+  };
+
+  struct Frame
+  {
+    CrosshairStyle crosshair;
+    HitMarkerStyle hitMarker;
+    DamageVignetteStyle vignette;
+
+    bool visible = false;
+    bool hasHealth = false;
+    float healthCurrent = 0.f;
+    float healthMax = 0.f;
+    bool parryFlash = false;
+    float hitMarkerRemaining = 0.f;
+    float damageRemaining = 0.f;
   };
 
   void setCrosshairStyle(CrosshairStyle style);
@@ -49,11 +67,7 @@ public:
               ecs::Registry& registry,
               ecs::Entity player);
 
-  void draw(sf::RenderWindow& window,
-            ecs::Registry& registry,
-            ecs::Entity player,
-            const sf::Font& font,
-            bool fontLoaded) const;
+  [[nodiscard]] Frame frame(ecs::Registry& registry, ecs::Entity player) const;
 
 private:
   CrosshairStyle m_crosshair;
@@ -62,25 +76,6 @@ private:
 
   float m_lastHp = -1.f;
   float m_damageRemaining = 0.f;
-
-  static float clamp01(float v);
-  static sf::Color crosshairColorFromHealth(float current, float max);
-
-  static void drawHealth(sf::RenderWindow& window,
-                  ecs::Registry& registry,
-                  ecs::Entity player,
-                  const sf::Font& font,
-                  bool fontLoaded) ;
-
-  void drawCrosshair(sf::RenderWindow& window,
-                     ecs::Registry& registry,
-                     ecs::Entity player) const;
-
-  void drawHitMarker(sf::RenderWindow& window,
-                     ecs::Registry& registry,
-                     ecs::Entity player) const;
-
-  void drawDamageVignette(sf::RenderWindow& window) const;
 };
 
 #endif //NULLP0INT_HUD_H
@@ -0,0 +1,319 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "HudView.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <SFML/Graphics/View.hpp>
+
+#include "GameUI.h"
+#include "../constants.h"
+
+float HudView::clamp01(const float v)
+{
+  return std::clamp(v, 0.f, 1.f);
+}
+
+sf::Color HudView::crosshairColorFromHealth(const float current, const float max)
+{
+  const float safeMax = (max > 0.0001f) ? max : 1.f;
+  const float damage = clamp01(1.f - (current / safeMax));
+
+  const auto gb = static_cast<sf::Uint8>(std::lround(255.f * (1.f - damage)));
+  return {255, gb, gb, 100};
+}
+
+void HudView::appendBar(sf::VertexArray& verts, const sf::Vector2f center, const sf::Vector2f size, const float rotationDeg)
+{
+  const float rad = rotationDeg * static_cast<float>(M_PI) / 180.f;
+  const float c = std::cos(rad);
+  const float s = std::sin(rad);
+  const float hx = size.x * 0.5f;
+  const float hy = size.y * 0.5f;
+
+  auto corner = [&](const float x, const float y) -> sf::Vertex
+  {
+    return sf::Vertex({center.x + x * c - y * s, center.y + x * s + y * c});
+  };
+
+  const sf::Vertex a = corner(-hx, -hy);
+  const sf::Vertex b = corner(hx, -hy);
+  const sf::Vertex d = corner(hx, hy);
+  const sf::Vertex e = corner(-hx, hy);
+
+  verts.append(a);
+  verts.append(b);
+  verts.append(d);
+  verts.append(a);
+  verts.append(d);
+  verts.append(e);
+}
+
+void HudView::setColor(sf::VertexArray& verts, const sf::Color color)
+{
+  for (std::size_t i = 0; i < verts.getVertexCount(); ++i)
+  {
+    verts[i].color = color;
+  }
+}
+
+void HudView::draw(sf::RenderTarget& target, const sf::Vector2u windowSize, const Hud::Frame& frame, const sf::Font& font,
+                   const bool fontLoaded)
+{
+  if (!frame.visible) return;
+
+  const sf::Vector2f size(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y));
+  const sf::View prevView = target.getView();
+  target.setView(sf::View(sf::FloatRect({0.f, 0.f}, size)));
+
+  drawDamageVignette(target, windowSize, frame);
+  drawCrosshair(target, windowSize, frame);
+  drawHitMarker(target, windowSize, frame);
+  drawHealth(target, windowSize, frame, font, fontLoaded);
+
+  target.setView(prevView);
+}
+
+void HudView::drawHealth(sf::RenderTarget& target, const sf::Vector2u windowSize, const Hud::Frame& frame,
+                         const sf::Font& font, const bool fontLoaded)
+{
+  if (!fontLoaded) return;
+  if (!frame.hasHealth) return;
+
+  const int cur = static_cast<int>(std::round(frame.healthCurrent));
+  const int mx = static_cast<int>(std::round(frame.healthMax));
+  const unsigned windowHeight = windowSize.y;
+
+  if (m_healthFont != &font)
+  {
+    m_healthText.setFont(font);
+    m_healthText.setCharacterSize(28);
+    m_healthText.setFillColor(sf::Color::White);
+    m_healthFont = &font;
+    m_healthCurrent = -1;
+  }
+
+  if (cur != m_healthCurrent || mx != m_healthMax || windowHeight != m_healthWindowHeight)
+  {
+    m_healthText.setString(toSfStringUtf8("HP: " + std::to_string(cur) + "/" + std::to_string(mx)));
+
+    const auto bounds = m_healthText.getLocalBounds();
+    constexpr float marginX = 18.f;
+    constexpr float marginY = 14.f;
+    const float y = static_cast<float>(windowHeight) - (bounds.top + bounds.height) - marginY;
+    m_healthText.setPosition(marginX, y);
+
+    m_healthCurrent = cur;
+    m_healthMax = mx;
+    m_healthWindowHeight = windowHeight;
+  }
+
+  target.draw(m_healthText);
+}
+
+void HudView::drawCrosshair(sf::RenderTarget& target, const sf::Vector2u windowSize, const Hud::Frame& frame)
+{
+  if (!frame.hasHealth) return;
+
+  const sf::Vector2u ws = windowSize;
+
+  if (frame.crosshair != m_crosshairStyle)
+  {
+    m_crosshairStyle = frame.crosshair;
+    m_crosshairDirty = true;
+  }
+
+  if (m_crosshairDirty || ws != m_crosshairWindowSize)
+  {
+    const sf::Vector2f center(static_cast<float>(ws.x) * 0.5f, static_cast<float>(ws.y) * 0.5f);
+
+    const float len = std::max(1.f, m_crosshairStyle.armLength);
+    const float thick = std::max(1.f, m_crosshairStyle.thickness);
+    const float gap = std::max(0.f, m_crosshairStyle.gap);
+
+    const sf::Vector2f size(len, thick);
+    const float offset = (gap * 0.5f) + (len * 0.5f);
+
+    m_crosshairVerts.clear();
+    appendBar(m_crosshairVerts, {center.x + offset, center.y}, size, 0.f);
+    appendBar(m_crosshairVerts, {center.x - offset, center.y}, size, 0.f);
+    appendBar(m_crosshairVerts, {center.x, center.y + offset}, size, 90.f);
+    appendBar(m_crosshairVerts, {center.x, center.y - offset}, size, 90.f);
+    setColor(m_crosshairVerts, m_crosshairColor);
+
+    m_crosshairWindowSize = ws;
+    m_crosshairDirty = false;
+  }
+
+  sf::Color color = crosshairColorFromHealth(frame.healthCurrent, frame.healthMax);
+
+  if (frame.parryFlash)
+  {
+    color = sf::Color(0, 255, 0, 255);
+  }
+
+  if (color != m_crosshairColor)
+  {
+    setColor(m_crosshairVerts, color);
+    m_crosshairColor = color;
+  }
+
+  target.draw(m_crosshairVerts);
+}
+
+void HudView::drawHitMarker(sf::RenderTarget& target, const sf::Vector2u windowSize, const Hud::Frame& frame)
+{
+  constexpr float duration = std::max(0.01f, HITMARKER_DURATION_SECONDS);
+  const float t = clamp01(frame.hitMarkerRemaining / duration);
+  if (t <= 0.f) return;
+
+  const sf::Vector2u ws = windowSize;
+
+  if (frame.hitMarker != m_hitMarkerStyle)
+  {
+    m_hitMarkerStyle = frame.hitMarker;
+    m_hitMarkerDirty = true;
+  }
+
+  if (m_hitMarkerDirty || ws != m_hitMarkerWindowSize)
+  {
+    const sf::Vector2f center(static_cast<float>(ws.x) * 0.5f, static_cast<float>(ws.y) * 0.5f);
+
+    const float len = std::max(1.f, m_hitMarkerStyle.armLength);
+    const float thick = std::max(1.f, m_hitMarkerStyle.thickness);
+    const float gap = std::max(0.f, m_hitMarkerStyle.gap);
+
+    const sf::Vector2f size(len, thick);
+    const float offset = (gap * 0.5f) + (len * 0.5f);
+
+    auto axisOffset = [&](const float deg) -> sf::Vector2f
+    {
+      const float rad = deg * M_PI / 180.f;
+      return { std::cos(rad) * offset, std::sin(rad) * offset };
+    };
+
+    constexpr float a1 = 45.f;
+    constexpr float a2 = -45.f;
+
+    m_hitMarkerVerts.clear();
+    sf::Vector2f d = axisOffset(a1);
+    appendBar(m_hitMarkerVerts, {center.x + d.x, center.y + d.y}, size, a1);
+    appendBar(m_hitMarkerVerts, {center.x - d.x, center.y - d.y}, size, a1);
+    d = axisOffset(a2);
+    appendBar(m_hitMarkerVerts, {center.x + d.x, center.y + d.y}, size, a2);
+    appendBar(m_hitMarkerVerts, {center.x - d.x, center.y - d.y}, size, a2);
+    setColor(m_hitMarkerVerts, sf::Color(255, 255, 255, m_hitMarkerAlpha));
+
+    m_hitMarkerWindowSize = ws;
+    m_hitMarkerDirty = false;
+  }
+
+  if (const auto alpha = static_cast<sf::Uint8>(std::lround(255.f * t)); alpha != m_hitMarkerAlpha)
+  {
+    setColor(m_hitMarkerVerts, sf::Color(255, 255, 255, alpha));
+    m_hitMarkerAlpha = alpha;
+  }
+
+  target.draw(m_hitMarkerVerts);
+}
+
+void HudView::drawDamageVignette(sf::RenderTarget& target, const sf::Vector2u windowSize, const Hud::Frame& frame)
+{
+  if (frame.damageRemaining <= 0.f) return;
+
+  if (frame.vignette != m_vignetteStyle)
+  {
+    m_vignetteStyle = frame.vignette;
+    m_vignetteDirty = true;
+  }
+
+  const float duration = std::max(0.01f, m_vignetteStyle.durationSeconds);
+  const float k = clamp01(frame.damageRemaining / duration);
+  const int bucket = static_cast<int>(std::ceil(k * k * static_cast<float>(HUD_VIGNETTE_INTENSITY_STEPS)));
+  if (bucket <= 0) return;
+
+  if (const sf::Vector2u ws = windowSize; m_vignetteDirty || ws != m_vignetteWindowSize)
+  {
+    rebuildVignetteGeometry(windowSize);
+  }
+
+  if (bucket != m_vignetteBucket)
+  {
+    const float intensity = static_cast<float>(bucket) / static_cast<float>(HUD_VIGNETTE_INTENSITY_STEPS);
+    const float maxA = static_cast<float>(m_vignetteStyle.maxAlpha) * intensity;
+
+    for (std::size_t i = 0; i < m_vignetteVerts.getVertexCount(); ++i)
+    {
+      const float a = std::clamp(maxA * m_vignetteFalloff[i], 0.f, 255.f);
+      m_vignetteVerts[i].color = sf::Color(255, 0, 0, static_cast<sf::Uint8>(std::lround(a)));
+    }
+    m_vignetteBucket = bucket;
+  }
+
+  target.draw(m_vignetteVerts);
+}
+
+void HudView::rebuildVignetteGeometry(const sf::Vector2u windowSize)
+{
+  const int grid = std::clamp(m_vignetteStyle.grid, 5, 25);
+  const auto w = static_cast<float>(windowSize.x);
+  const auto h = static_cast<float>(windowSize.y);
+
+  const float cx = w * 0.5f;
+  const float cy = h * 0.5f;
+
+  const float inner = clamp01(m_vignetteStyle.innerRadius01);
+  const float expn = std::max(0.1f, m_vignetteStyle.exponent);
+
+  const int cells = grid - 1;
+  const auto count = static_cast<std::size_t>(cells * cells * 6);
+  m_vignetteVerts.setPrimitiveType(sf::Triangles);
+  m_vignetteVerts.resize(count);
+  m_vignetteFalloff.resize(count);
+
+  auto falloffAt = [&](const float x, const float y) -> float
+  {
+    const float nx = (cx > 0.0001f) ? ((x - cx) / cx) : 0.f;
+    const float ny = (cy > 0.0001f) ? ((y - cy) / cy) : 0.f;
+    const float r = std::sqrt(nx * nx + ny * ny);
+
+    const float t2 = clamp01((r - inner) / std::max(0.0001f, 1.f - inner));
+    return std::pow(t2, expn);
+  };
+
+  std::size_t idx = 0;
+  auto vtx = [&](const float x, const float y)
+  {
+    m_vignetteVerts[idx].position = sf::Vector2f(x, y);
+    m_vignetteFalloff[idx] = falloffAt(x, y);
+    ++idx;
+  };
+
+  for (int iy = 0; iy < cells; ++iy)
+  {
+    const float y0 = (static_cast<float>(iy) / static_cast<float>(cells)) * h;
+    const float y1 = (static_cast<float>(iy + 1) / static_cast<float>(cells)) * h;
+
+    for (int ix = 0; ix < cells; ++ix)
+    {
+      const float x0 = (static_cast<float>(ix) / static_cast<float>(cells)) * w;
+      const float x1 = (static_cast<float>(ix + 1) / static_cast<float>(cells)) * w;
+
+      vtx(x0, y0);
+      vtx(x1, y0);
+      vtx(x1, y1);
+
+      vtx(x0, y0);
+      vtx(x1, y1);
+      vtx(x0, y1);
+    }
+  }
+
+  m_vignetteWindowSize = windowSize;
+  m_vignetteBucket = -1;
+  m_vignetteDirty = false;
+}
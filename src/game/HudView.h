@@ -0,0 +1,62 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_HUDVIEW_H
+#define NULLP0INT_HUDVIEW_H
+
+#include <vector>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include "Hud.h"
+
+class HudView
+{
+public:
+  void draw(sf::RenderTarget& target, sf::Vector2u windowSize, const Hud::Frame& frame, const sf::Font& font, bool fontLoaded);
+
+private:
+  sf::Text m_healthText;
+  const sf::Font* m_healthFont = nullptr;
+  int m_healthCurrent = -1;
+  int m_healthMax = -1;
+  unsigned m_healthWindowHeight = 0;
+
+  sf::VertexArray m_crosshairVerts{sf::Triangles};
+  Hud::CrosshairStyle m_crosshairStyle;
+  sf::Vector2u m_crosshairWindowSize;
+  sf::Color m_crosshairColor = sf::Color::Transparent;
+  bool m_crosshairDirty = true;
+
+  sf::VertexArray m_hitMarkerVerts{sf::Triangles};
+  Hud::HitMarkerStyle m_hitMarkerStyle;
+  sf::Vector2u m_hitMarkerWindowSize;
+  sf::Uint8 m_hitMarkerAlpha = 0;
+  bool m_hitMarkerDirty = true;
+
+  sf::VertexArray m_vignetteVerts{sf::Triangles};
+  std::vector<float> m_vignetteFalloff;
+  Hud::DamageVignetteStyle m_vignetteStyle;
+  sf::Vector2u m_vignetteWindowSize;
+  int m_vignetteBucket = -1;
+  bool m_vignetteDirty = true;
+
+  static float clamp01(float v);
+  static sf::Color crosshairColorFromHealth(float current, float max);
+  static void appendBar(sf::VertexArray& verts, sf::Vector2f center, sf::Vector2f size, float rotationDeg);
+  static void setColor(sf::VertexArray& verts, sf::Color color);
+
+  void drawHealth(sf::RenderTarget& target, sf::Vector2u windowSize, const Hud::Frame& frame, const sf::Font& font,
+                  bool fontLoaded);
+  void drawCrosshair(sf::RenderTarget& target, sf::Vector2u windowSize, const Hud::Frame& frame);
+  void drawHitMarker(sf::RenderTarget& target, sf::Vector2u windowSize, const Hud::Frame& frame);
+  void drawDamageVignette(sf::RenderTarget& target, sf::Vector2u windowSize, const Hud::Frame& frame);
+  void rebuildVignetteGeometry(sf::Vector2u windowSize);
+};
+
+#endif //NULLP0INT_HUDVIEW_H
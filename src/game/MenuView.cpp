@@ -0,0 +1,131 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#include "MenuView.h"
+
+#include <SFML/Window/Mouse.hpp>
+
+#include "Game.h"
+#include "GameUI.h"
+
+void MenuView::draw(sf::RenderWindow& window,
+                    const sf::Vector2u windowSize,
+                    const sf::Font& font,
+                    const bool fontLoaded,
+                    const std::string& title,
+                    const std::vector<UIButton>& buttons,
+                    const bool darkenBackground)
+{
+  syncFont(font);
+
+  if (darkenBackground) drawOverlay(window, windowSize);
+  if (fontLoaded) drawTitle(window, windowSize.x, title, 160.f);
+
+  if (m_buttons.size() != buttons.size()) m_buttons.resize(buttons.size());
+
+  const sf::Vector2f mousePos = window.mapPixelToCoords(sf::Mouse::getPosition(window));
+  for (std::size_t i = 0; i < buttons.size(); ++i)
+  {
+    drawButton(window, m_buttons[i], buttons[i], mousePos, fontLoaded);
+  }
+}
+
+void MenuView::syncFont(const sf::Font& font)
+{
+  if (m_font == &font) return;
+
+  m_font = &font;
+  m_titleValid = false;
+  for (auto& view : m_buttons)
+  {
+    view.textValid = false;
+  }
+}
+
+void MenuView::drawOverlay(sf::RenderWindow& window, const sf::Vector2u windowSize)
+{
+  if (const sf::Vector2u ws = windowSize; ws != m_overlaySize)
+  {
+    m_overlay.setSize({static_cast<float>(ws.x), static_cast<float>(ws.y)});
+    m_overlay.setPosition(0.f, 0.f);
+    m_overlay.setFillColor(sf::Color(0, 0, 0, 140));
+    m_overlaySize = ws;
+  }
+
+  window.draw(m_overlay);
+}
+
+void MenuView::drawTitle(sf::RenderWindow& window, const unsigned windowWidth, const std::string& title, const float y)
+{
+  if (!m_titleValid || title != m_titleString || windowWidth != m_titleWindowWidth)
+  {
+    m_title.setFont(*m_font);
+    m_title.setString(toSfStringUtf8(title));
+    m_title.setCharacterSize(64);
+    m_title.setFillColor(sf::Color::White);
+
+    const sf::FloatRect b = m_title.getLocalBounds();
+    const float x = (static_cast<float>(windowWidth) - b.width) * 0.5f - b.left;
+    m_title.setPosition(x, y);
+
+    m_titleString = title;
+    m_titleWindowWidth = windowWidth;
+    m_titleValid = true;
+  }
+
+  window.draw(m_title);
+}
+
+void MenuView::applyHover(ButtonView& view, const bool hovered)
+{
+  view.shape.setFillColor(hovered ? sf::Color(55, 55, 55, 235) : sf::Color(30, 30, 30, 235));
+  view.shape.setOutlineColor(hovered ? sf::Color(200, 200, 200) : sf::Color(120, 120, 120));
+  view.hovered = hovered;
+}
+
+void MenuView::drawButton(sf::RenderWindow& window,
+                          ButtonView& view,
+                          const UIButton& b,
+                          const sf::Vector2f mousePos,
+                          const bool fontLoaded)
+{
+  const bool rectChanged = b.rect != view.rect;
+  const bool hovered = b.rect.contains(mousePos);
+
+  if (rectChanged)
+  {
+    view.shape.setPosition({b.rect.left, b.rect.top});
+    view.shape.setSize({b.rect.width, b.rect.height});
+    view.shape.setOutlineThickness(2.f);
+    view.rect = b.rect;
+    view.textValid = false;
+    applyHover(view, hovered);
+  }
+  else if (hovered != view.hovered)
+  {
+    applyHover(view, hovered);
+  }
+
+  window.draw(view.shape);
+
+  if (!fontLoaded) return;
+
+  if (!view.textValid || b.label != view.label)
+  {
+    view.text.setFont(*m_font);
+    view.text.setString(toSfStringUtf8(b.label));
+    view.text.setCharacterSize(32);
+    view.text.setFillColor(sf::Color::White);
+
+    const sf::FloatRect bounds = view.text.getLocalBounds();
+    const float tx = b.rect.left + (b.rect.width - bounds.width) * 0.5f - bounds.left;
+    const float ty = b.rect.top + (b.rect.height - bounds.height) * 0.5f - bounds.top;
+    view.text.setPosition(tx, ty);
+
+    view.label = b.label;
+    view.textValid = true;
+  }
+
+  window.draw(view.text);
+}
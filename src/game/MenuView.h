@@ -0,0 +1,59 @@
+//
+// Created by obamium3157 on 19.10.2026.
+//
+
+#ifndef NULLP0INT_MENUVIEW_H
+#define NULLP0INT_MENUVIEW_H
+
+#include <string>
+#include <vector>
+
+#include <SFML/Graphics/Font.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+#include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/Text.hpp>
+
+struct UIButton;
+
+class MenuView
+{
+public:
+  void draw(sf::RenderWindow& window,
+            sf::Vector2u windowSize,
+            const sf::Font& font,
+            bool fontLoaded,
+            const std::string& title,
+            const std::vector<UIButton>& buttons,
+            bool darkenBackground);
+
+private:
+  struct ButtonView
+  {
+    sf::FloatRect rect;
+    std::string label;
+    bool hovered = false;
+    bool textValid = false;
+    sf::RectangleShape shape;
+    sf::Text text;
+  };
+
+  const sf::Font* m_font = nullptr;
+
+  sf::RectangleShape m_overlay;
+  sf::Vector2u m_overlaySize;
+
+  sf::Text m_title;
+  std::string m_titleString;
+  unsigned m_titleWindowWidth = 0;
+  bool m_titleValid = false;
+
+  std::vector<ButtonView> m_buttons;
+
+  void syncFont(const sf::Font& font);
+  void drawOverlay(sf::RenderWindow& window, sf::Vector2u windowSize);
+  void drawTitle(sf::RenderWindow& window, unsigned windowWidth, const std::string& title, float y);
+  static void applyHover(ButtonView& view, bool hovered);
+  void drawButton(sf::RenderWindow& window, ButtonView& view, const UIButton& b, sf::Vector2f mousePos, bool fontLoaded);
+};
+
+#endif //NULLP0INT_MENUVIEW_H
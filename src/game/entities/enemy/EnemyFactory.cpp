@@ -5,6 +5,7 @@
 #include "EnemyFactory.h"
 
 #include "../../../ecs/Components.h"
+#include "../../../ecs/systems/physics/InterpolationSystem.h"
 
 namespace
 {
@@ -55,6 +56,8 @@ ecs::Entity initEnemy(ecs::Registry& registry,
   registry.addComponent<ecs::RadiusComponent>(enemy, ecs::RadiusComponent{radius});
   registry.addComponent<ecs::VelocityComponent>(enemy, ecs::VelocityComponent{});
   registry.addComponent<ecs::EnemyTag>(enemy, ecs::EnemyTag{});
+  registry.addComponent<ecs::NavPathComponent>(enemy, ecs::NavPathComponent{});
+  registry.addComponent<ecs::AiLodComponent>(enemy, ecs::AiLodComponent{});
 
   float speed = 0.f;
   float maxHp = 40.f;
@@ -132,6 +135,7 @@ ecs::Entity initEnemy(ecs::Registry& registry,
   sc.frameAccumulator = 0.f;
   sc.textureId = ec.textureId;
   registry.addComponent<ecs::SpriteComponent>(enemy, sc);
+  ecs::InterpolationSystem::snap(registry, enemy);
 
   return enemy;
 }
@@ -160,4 +164,6 @@ void spawnEnemiesFromMap(ecs::Registry &registry, const ecs::Entity tilemapEntit
       row[static_cast<std::size_t>(x)] = FLOOR_MARKER;
     }
   }
+
+  map->markTilesChanged();
 }
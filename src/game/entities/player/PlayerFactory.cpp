@@ -5,6 +5,7 @@
 #include "PlayerFactory.h"
 
 #include "../../../ecs/Components.h"
+#include "../../../ecs/systems/physics/InterpolationSystem.h"
 
 #include "../../weapons/PistolWeapon.h"
 #include "../../weapons/ShotgunWeapon.h"
@@ -31,6 +32,7 @@ ecs::Entity initPlayer(ecs::Registry &registry, const sf::Vector2f initialPos, c
 
   registry.addComponent<ecs::WeaponInventoryComponent>(player, inv);
   registry.addComponent<ecs::PlayerWeaponInputState>(player, ecs::PlayerWeaponInputState{});
+  ecs::InterpolationSystem::snap(registry, player);
 
   return player;
 }